@@ -37,4 +37,5 @@
 #include "openvino/c/ov_remote_context.h"
 #include "openvino/c/ov_shape.h"
 #include "openvino/c/ov_tensor.h"
+#include "openvino/c/ov_tensor_pool.h"
 #include "openvino/c/ov_util.h"
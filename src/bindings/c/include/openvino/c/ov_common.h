@@ -122,6 +122,10 @@
  * @ingroup ov_c_api
  * @brief The definitions & operations about tensor
  *
+ * @defgroup ov_tensor_pool_c_api Tensor Pool
+ * @ingroup ov_c_api
+ * @brief The definitions & operations about pool of pre-registered input tensors
+ *
  * @defgroup ov_remote_context_c_api Remote Context
  * @ingroup ov_c_api
  * @brief Set of functions representing of RemoteContext
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for the ov_tensor_pool C API.
+ * Tensor pool holds host buffers registered once per compiled model input, which can be bound
+ * to infer requests by index without creating and validating a tensor for every request.
+ * @file ov_tensor_pool.h
+ */
+
+#pragma once
+
+#include "openvino/c/ov_common.h"
+#include "openvino/c/ov_compiled_model.h"
+#include "openvino/c/ov_infer_request.h"
+#include "openvino/c/ov_shape.h"
+
+/**
+ * @struct ov_tensor_pool_t
+ * @ingroup ov_tensor_pool_c_api
+ * @brief type define ov_tensor_pool_t from ov_tensor_pool
+ */
+typedef struct ov_tensor_pool ov_tensor_pool_t;
+
+/**
+ * @brief Creates an empty tensor pool for inputs of the compiled model.
+ * @ingroup ov_tensor_pool_c_api
+ * @param compiled_model A pointer to the ov_compiled_model_t.
+ * @param tensor_pool A pointer to the newly created ov_tensor_pool_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_create(const ov_compiled_model_t* compiled_model, ov_tensor_pool_t** tensor_pool);
+
+/**
+ * @brief Registers a pre-allocated host buffer for the input with a given index.
+ * Element type of the buffer is the element type of the input. The shape is checked against the input
+ * shape once, during registration. The memory is not copied and must stay valid until the pool is freed.
+ * Registration is not thread-safe and must not run concurrently with binding of buffers from the same pool.
+ * @ingroup ov_tensor_pool_c_api
+ * @param tensor_pool A pointer to the ov_tensor_pool_t.
+ * @param input_index Index of the compiled model input.
+ * @param shape Shape of the data stored in the buffer.
+ * @param host_ptr Pointer to pre-allocated host memory.
+ * @param buffer_index Index of the registered buffer for the input.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_register_buffer(ov_tensor_pool_t* tensor_pool,
+                               const size_t input_index,
+                               const ov_shape_t shape,
+                               void* host_ptr,
+                               size_t* buffer_index);
+
+/**
+ * @brief Gets the number of buffers registered for the input with a given index.
+ * @ingroup ov_tensor_pool_c_api
+ * @param tensor_pool A pointer to the ov_tensor_pool_t.
+ * @param input_index Index of the compiled model input.
+ * @param size The number of registered buffers.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_get_buffers_size(const ov_tensor_pool_t* tensor_pool, const size_t input_index, size_t* size);
+
+/**
+ * @brief Release the memory allocated by ov_tensor_pool_t. Registered host buffers are not released.
+ * @ingroup ov_tensor_pool_c_api
+ * @param tensor_pool A pointer to the ov_tensor_pool_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_tensor_pool_free(ov_tensor_pool_t* tensor_pool);
+
+/**
+ * @brief Set a registered buffer of the pool as an input tensor of the infer request.
+ * @ingroup ov_tensor_pool_c_api
+ * @param infer_request A pointer to the ov_infer_request_t created from the same compiled model as the pool.
+ * @param tensor_pool A pointer to the ov_tensor_pool_t.
+ * @param input_index Index of the compiled model input.
+ * @param buffer_index Index of the buffer returned by ov_tensor_pool_register_buffer.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_input_tensor_from_pool(ov_infer_request_t* infer_request,
+                                            const ov_tensor_pool_t* tensor_pool,
+                                            const size_t input_index,
+                                            const size_t buffer_index);
+
+/**
+ * @brief Set registered buffers of the pool as all input tensors of the infer request.
+ * @ingroup ov_tensor_pool_c_api
+ * @param infer_request A pointer to the ov_infer_request_t created from the same compiled model as the pool.
+ * @param tensor_pool A pointer to the ov_tensor_pool_t.
+ * @param buffer_indices Array of buffer indices, one for every input of the compiled model.
+ * @param buffer_indices_size Size of the buffer_indices array, must be equal to the number of inputs.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_input_tensors_from_pool(ov_infer_request_t* infer_request,
+                                             const ov_tensor_pool_t* tensor_pool,
+                                             const size_t* buffer_indices,
+                                             const size_t buffer_indices_size);
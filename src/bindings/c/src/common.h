@@ -201,6 +201,16 @@ struct ov_remote_context {
     std::shared_ptr<ov::RemoteContext> object;
 };
 
+/**
+ * @struct ov_tensor_pool
+ * @brief This is a set of host tensors pre-registered for inputs of ov::CompiledModel
+ */
+struct ov_tensor_pool {
+    std::shared_ptr<ov::CompiledModel> compiled_model;
+    std::vector<ov::Output<const ov::Node>> inputs;
+    std::vector<std::vector<ov::Tensor>> buffers;
+};
+
 /**
  * @struct mem_stringbuf
  * @brief This struct puts memory buffer to stringbuf.
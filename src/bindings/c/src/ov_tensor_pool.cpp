@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "openvino/c/ov_tensor_pool.h"
+
+#include "common.h"
+
+ov_status_e ov_tensor_pool_create(const ov_compiled_model_t* compiled_model, ov_tensor_pool_t** tensor_pool) {
+    if (!compiled_model || !tensor_pool) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_tensor_pool_t> _tensor_pool(new ov_tensor_pool_t);
+        _tensor_pool->compiled_model = compiled_model->object;
+        _tensor_pool->inputs = std::const_pointer_cast<const ov::CompiledModel>(compiled_model->object)->inputs();
+        _tensor_pool->buffers.resize(_tensor_pool->inputs.size());
+        *tensor_pool = _tensor_pool.release();
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_register_buffer(ov_tensor_pool_t* tensor_pool,
+                                           const size_t input_index,
+                                           const ov_shape_t shape,
+                                           void* host_ptr,
+                                           size_t* buffer_index) {
+    if (!tensor_pool || !host_ptr || !buffer_index || input_index >= tensor_pool->inputs.size()) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        const auto& input = tensor_pool->inputs[input_index];
+        const auto& type = input.get_element_type();
+        OPENVINO_ASSERT(type.is_static() && type != ov::element::string,
+                        "Tensor pool does not support input with element type ",
+                        type);
+
+        ov::Shape tmp_shape;
+        std::copy_n(shape.dims, shape.rank, std::back_inserter(tmp_shape));
+        OPENVINO_ASSERT(input.get_partial_shape().compatible(tmp_shape),
+                        "Shape ",
+                        tmp_shape,
+                        " of registered buffer is not compatible with input shape ",
+                        input.get_partial_shape());
+
+        auto& buffers = tensor_pool->buffers[input_index];
+        buffers.emplace_back(type, tmp_shape, host_ptr);
+        *buffer_index = buffers.size() - 1;
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_get_buffers_size(const ov_tensor_pool_t* tensor_pool,
+                                            const size_t input_index,
+                                            size_t* size) {
+    if (!tensor_pool || !size || input_index >= tensor_pool->buffers.size()) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    *size = tensor_pool->buffers[input_index].size();
+    return ov_status_e::OK;
+}
+
+void ov_tensor_pool_free(ov_tensor_pool_t* tensor_pool) {
+    if (tensor_pool)
+        delete tensor_pool;
+}
+
+ov_status_e ov_infer_request_set_input_tensor_from_pool(ov_infer_request_t* infer_request,
+                                                        const ov_tensor_pool_t* tensor_pool,
+                                                        const size_t input_index,
+                                                        const size_t buffer_index) {
+    if (!infer_request || !tensor_pool || input_index >= tensor_pool->buffers.size() ||
+        buffer_index >= tensor_pool->buffers[input_index].size()) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        infer_request->object->set_tensor(tensor_pool->inputs[input_index],
+                                          tensor_pool->buffers[input_index][buffer_index]);
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_infer_request_set_input_tensors_from_pool(ov_infer_request_t* infer_request,
+                                                         const ov_tensor_pool_t* tensor_pool,
+                                                         const size_t* buffer_indices,
+                                                         const size_t buffer_indices_size) {
+    if (!infer_request || !tensor_pool || !buffer_indices || buffer_indices_size != tensor_pool->buffers.size()) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    for (size_t i = 0; i < buffer_indices_size; i++) {
+        if (buffer_indices[i] >= tensor_pool->buffers[i].size()) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+    }
+
+    try {
+        for (size_t i = 0; i < buffer_indices_size; i++) {
+            infer_request->object->set_tensor(tensor_pool->inputs[i], tensor_pool->buffers[i][buffer_indices[i]]);
+        }
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
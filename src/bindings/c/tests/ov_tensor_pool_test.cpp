@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "ov_test.hpp"
+
+namespace {
+
+class ov_tensor_pool_test : public ov_capi_test_base {
+protected:
+    void SetUp() override {
+        auto device_name = GetParam();
+        core = nullptr;
+        model = nullptr;
+        compiled_model = nullptr;
+        infer_request = nullptr;
+        tensor_pool = nullptr;
+        ov_capi_test_base::SetUp();
+
+        OV_EXPECT_OK(ov_core_create(&core));
+        EXPECT_NE(nullptr, core);
+
+        OV_EXPECT_OK(ov_core_read_model(core, xml_file_name.c_str(), bin_file_name.c_str(), &model));
+        EXPECT_NE(nullptr, model);
+
+        OV_EXPECT_OK(ov_core_compile_model(core, model, device_name.c_str(), 0, &compiled_model));
+        EXPECT_NE(nullptr, compiled_model);
+
+        OV_EXPECT_OK(ov_compiled_model_create_infer_request(compiled_model, &infer_request));
+        EXPECT_NE(nullptr, infer_request);
+
+        ov_output_const_port_t* input_port = nullptr;
+        OV_EXPECT_OK(ov_compiled_model_input(compiled_model, &input_port));
+        OV_EXPECT_OK(ov_const_port_get_shape(input_port, &input_shape));
+        ov_output_const_port_free(input_port);
+
+        size_t size = 1;
+        for (int64_t i = 0; i < input_shape.rank; ++i) {
+            size *= static_cast<size_t>(input_shape.dims[i]);
+        }
+        buffers.assign(2, std::vector<float>(size, 0.f));
+
+        OV_EXPECT_OK(ov_tensor_pool_create(compiled_model, &tensor_pool));
+        EXPECT_NE(nullptr, tensor_pool);
+    }
+    void TearDown() override {
+        ov_tensor_pool_free(tensor_pool);
+        ov_shape_free(&input_shape);
+        ov_infer_request_free(infer_request);
+        ov_compiled_model_free(compiled_model);
+        ov_model_free(model);
+        ov_core_free(core);
+        ov_capi_test_base::TearDown();
+    }
+
+public:
+    ov_core_t* core;
+    ov_model_t* model;
+    ov_compiled_model_t* compiled_model;
+    ov_infer_request_t* infer_request;
+    ov_tensor_pool_t* tensor_pool;
+    ov_shape_t input_shape = {0, nullptr};
+    std::vector<std::vector<float>> buffers;
+};
+
+INSTANTIATE_TEST_SUITE_P(ov_tensor_pool, ov_tensor_pool_test, ::testing::Values("CPU"));
+
+TEST_P(ov_tensor_pool_test, register_buffer) {
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        size_t buffer_index = 0;
+        OV_EXPECT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, input_shape, buffers[i].data(), &buffer_index));
+        EXPECT_EQ(i, buffer_index);
+    }
+
+    size_t size = 0;
+    OV_EXPECT_OK(ov_tensor_pool_get_buffers_size(tensor_pool, 0, &size));
+    EXPECT_EQ(buffers.size(), size);
+}
+
+TEST_P(ov_tensor_pool_test, register_buffer_error_handling) {
+    size_t buffer_index = 0;
+    OV_EXPECT_NOT_OK(ov_tensor_pool_register_buffer(nullptr, 0, input_shape, buffers[0].data(), &buffer_index));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, input_shape, nullptr, &buffer_index));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, input_shape, buffers[0].data(), nullptr));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_register_buffer(tensor_pool, 1, input_shape, buffers[0].data(), &buffer_index));
+
+    ov_shape_t wrong_shape;
+    int64_t dims[2] = {1, 3};
+    OV_EXPECT_OK(ov_shape_create(2, dims, &wrong_shape));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, wrong_shape, buffers[0].data(), &buffer_index));
+    ov_shape_free(&wrong_shape);
+}
+
+TEST_P(ov_tensor_pool_test, infer_with_pool_buffers) {
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        size_t buffer_index = 0;
+        OV_EXPECT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, input_shape, buffers[i].data(), &buffer_index));
+    }
+
+    for (size_t i = 0; i < 4; ++i) {
+        const size_t buffer_index = i % buffers.size();
+        OV_EXPECT_OK(ov_infer_request_set_input_tensor_from_pool(infer_request, tensor_pool, 0, buffer_index));
+
+        ov_tensor_t* tensor = nullptr;
+        void* data = nullptr;
+        OV_EXPECT_OK(ov_infer_request_get_input_tensor(infer_request, &tensor));
+        OV_EXPECT_OK(ov_tensor_data(tensor, &data));
+        EXPECT_EQ(buffers[buffer_index].data(), data);
+        ov_tensor_free(tensor);
+
+        OV_EXPECT_OK(ov_infer_request_infer(infer_request));
+    }
+
+    const size_t buffer_indices[1] = {1};
+    OV_EXPECT_OK(ov_infer_request_set_input_tensors_from_pool(infer_request, tensor_pool, buffer_indices, 1));
+    OV_EXPECT_OK(ov_infer_request_infer(infer_request));
+}
+
+TEST_P(ov_tensor_pool_test, set_input_tensor_from_pool_error_handling) {
+    size_t buffer_index = 0;
+    OV_EXPECT_OK(ov_tensor_pool_register_buffer(tensor_pool, 0, input_shape, buffers[0].data(), &buffer_index));
+
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensor_from_pool(nullptr, tensor_pool, 0, 0));
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensor_from_pool(infer_request, nullptr, 0, 0));
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensor_from_pool(infer_request, tensor_pool, 1, 0));
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensor_from_pool(infer_request, tensor_pool, 0, 1));
+
+    const size_t buffer_indices[2] = {0, 0};
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensors_from_pool(infer_request, tensor_pool, buffer_indices, 2));
+    OV_EXPECT_NOT_OK(ov_infer_request_set_input_tensors_from_pool(infer_request, tensor_pool, nullptr, 1));
+}
+
+}  // namespace
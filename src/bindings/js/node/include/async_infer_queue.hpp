@@ -6,6 +6,9 @@
 #include <napi.h>
 
 #include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -13,9 +16,43 @@
 
 #include "openvino/runtime/infer_request.hpp"
 
+class AsyncInferQueue;
+
+/**
+ * @brief State of AsyncInferQueue shared with the calls that reach the queue from other threads.
+ *
+ * The state is shared with the completion callbacks of the started requests and with the hand-over
+ * calls of other queues, so the queue may be released or destroyed while they are in flight.
+ * A request handed over to the queue from another thread stays in pending_handles, and a completed
+ * request stays in completed_handles, until the queue receives it in its own thread. A queue destroyed
+ * before that returns such requests to the pool, and so does a request completed after the queue
+ * was released or destroyed.
+ */
+struct QueueState {
+    AsyncInferQueue* queue;                 // dereferenced only in the thread of the queue
+    Napi::ThreadSafeFunction tsfn;          // guarded by InferRequestPool::mutex
+    std::vector<size_t> pending_handles;    // guarded by InferRequestPool::mutex
+    std::vector<size_t> completed_handles;  // guarded by InferRequestPool::mutex
+};
+
+/**
+ * @brief Pool of infer requests owned by one or several AsyncInferQueue objects.
+ *
+ * AsyncInferQueue objects created in different worker_threads from the same shared id
+ * use one pool. A request is started and completed in the thread of the queue which
+ * took it from the pool, the idle request is handed over to the queue that waits longest.
+ */
+struct InferRequestPool {
+    std::vector<ov::InferRequest> requests;
+    std::queue<size_t> idle_handles;
+    std::deque<std::shared_ptr<QueueState>> waiters;
+    std::mutex mutex;
+};
+
 class AsyncInferQueue : public Napi::ObjectWrap<AsyncInferQueue> {
 public:
     AsyncInferQueue(const Napi::CallbackInfo& info);
+    ~AsyncInferQueue() override;
     static Napi::Function get_class(Napi::Env env);
 
     void release(const Napi::CallbackInfo& info);
@@ -25,6 +62,11 @@ public:
      * @param info[1] Napi::Object containing user data that will be passed to the callback. [Optional]
      */
     Napi::Value start_async(const Napi::CallbackInfo& info);
+    /**
+     * @brief Returns an id which can be passed to another worker thread to create
+     * AsyncInferQueue over the same pool of infer requests.
+     */
+    Napi::Value share(const Napi::CallbackInfo& info);
 
 private:
     int check_idle_request_id();
@@ -32,18 +74,33 @@ private:
                           Napi::Object infer_data,
                           Napi::Object user_data,
                           Napi::Promise::Deferred deferred);
+    void set_request_callback(const size_t handle);
+    // Calls the user callback of the completed request. Runs on the JS thread.
+    void on_request_completed(Napi::Env env,
+                              Napi::Function user_callback,
+                              const size_t handle,
+                              std::exception_ptr exception_ptr);
+    // Returns the request to the pool or hands it over to a waiting queue. Runs on the JS thread.
+    void release_handle(const size_t handle);
+    // Hands the request over to the queue which waits longest or returns it to the pool. Returns true if
+    // the waiting queue is `self`, then the caller delivers the request itself. Runs on any thread.
+    static bool hand_over(const std::shared_ptr<InferRequestPool>& pool,
+                          const size_t handle,
+                          const std::shared_ptr<QueueState>& self);
+    // Starts the oldest awaiting inference on the request. Runs on the JS thread.
+    void on_handle_available(const size_t handle);
     void set_tsfn(Napi::Env env, Napi::Function callback);
     void release();
+    // Stops waiting for the requests of the pool and returns the requests handed over, but not received yet.
+    void detach_from_pool();
 
-    // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
-    // all of requests are destroyed as well.
-    std::vector<ov::InferRequest> m_requests;
+    // The pool is the owner of all requests. When the last AsyncInferQueue which uses the pool
+    // is destroyed, all of requests are destroyed as well.
+    std::shared_ptr<InferRequestPool> m_pool;
+    std::shared_ptr<QueueState> m_state;
     std::vector<Napi::ObjectReference> m_user_inputs;  // to prevent garbage collection
     std::vector<std::pair<Napi::ObjectReference, Napi::Promise::Deferred>> m_user_ids;
 
-    std::queue<size_t> m_idle_handles;
+    // Accessed only from the JS thread of this queue
     std::queue<std::tuple<Napi::ObjectReference, Napi::ObjectReference, Napi::Promise::Deferred>> m_awaiting_requests;
-
-    std::mutex m_mutex;
-    Napi::ThreadSafeFunction m_tsfn;
 };
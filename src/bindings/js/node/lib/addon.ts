@@ -452,6 +452,10 @@ export interface CompiledModel {
  * the responsibility for maintaining the reference to the TypedArray lies with
  * the user. Any action performed on the TypedArray will be reflected in this
  * tensor memory.
+ *
+ * The TypedArray can be a view over a SharedArrayBuffer. Tensors created
+ * in different worker threads over views of the same SharedArrayBuffer
+ * use the same memory without copying.
  */
 export interface Tensor {
   /**
@@ -731,6 +735,13 @@ export interface AsyncInferQueue {
    * jobs number will be set automatically to the optimal number.
    */
   new (compiledModel: CompiledModel, jobs?: number): AsyncInferQueue;
+  /**
+   * Creates AsyncInferQueue which uses the pool of InferRequests of another
+   * AsyncInferQueue, possibly created in another worker thread.
+   * Callbacks are called in the thread of the queue that started the inference.
+   * @param sharedId The id returned by {@link AsyncInferQueue.share}.
+   */
+  new (sharedId: number): AsyncInferQueue;
   /**
    * Sets unified callback on all InferRequests from queue's pool.
    * The callback that was previously set will be replaced.
@@ -754,6 +765,13 @@ export interface AsyncInferQueue {
    * and the AsyncInferQueue is no longer needed.
    */
   release(): void;
+  /**
+   * Returns an id of the pool of InferRequests used by this queue.
+   * The id can be passed to worker threads, e.g. with `workerData`
+   * or `postMessage`, to create AsyncInferQueue over the same pool.
+   * The pool is alive while any AsyncInferQueue which uses it exists.
+   */
+  share(): number;
 }
 
 export declare enum element {
@@ -4,15 +4,23 @@
 
 #include "node/include/async_infer_queue.hpp"
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace {
 constexpr const char* UNDEFINED_USER_DATA = "UNDEFINED";
-}
+
+// Pools shared with AsyncInferQueue objects created in other worker threads.
+// Addon instances of all worker threads are loaded into the same process, so the registry is common for them.
+std::mutex shared_pools_mutex;
+std::unordered_map<uint32_t, std::weak_ptr<InferRequestPool>> shared_pools;
+uint32_t next_shared_pool_id = 1;
+}  // namespace
 
 #include "node/include/addon.hpp"
 #include "node/include/compiled_model.hpp"
@@ -29,26 +37,41 @@ AsyncInferQueue::AsyncInferQueue(const Napi::CallbackInfo& info) : Napi::ObjectW
 
     try {
         const auto are_arguments_valid = ov::js::validate<CompiledModelWrap>(info, allowed_signatures) ||
-                                         ov::js::validate<CompiledModelWrap, int>(info, allowed_signatures);
+                                         ov::js::validate<CompiledModelWrap, int>(info, allowed_signatures) ||
+                                         ov::js::validate<int>(info, allowed_signatures);
         OPENVINO_ASSERT(are_arguments_valid,
                         "'AsyncInferQueue' constructor",
                         ov::js::get_parameters_error_msg(info, allowed_signatures));
 
-        auto& compiled = Napi::ObjectWrap<CompiledModelWrap>::Unwrap(info[0].ToObject())->get_compiled_model();
-        size_t jobs =
-            info.Length() == 1 ? get_optimal_number_of_requests(compiled) : info[1].As<Napi::Number>().Int32Value();
-        m_tsfn = nullptr;
+        if (info[0].IsNumber()) {
+            // Attach to the pool shared by AsyncInferQueue from another worker thread
+            const auto shared_id = info[0].As<Napi::Number>().Uint32Value();
+            std::lock_guard<std::mutex> lock(shared_pools_mutex);
+            const auto it = shared_pools.find(shared_id);
+            m_pool = it != shared_pools.end() ? it->second.lock() : nullptr;
+            OPENVINO_ASSERT(m_pool, "AsyncInferQueue with shared id ", shared_id, " does not exist.");
+        } else {
+            auto& compiled = Napi::ObjectWrap<CompiledModelWrap>::Unwrap(info[0].ToObject())->get_compiled_model();
+            size_t jobs = info.Length() == 1 ? get_optimal_number_of_requests(compiled)
+                                             : info[1].As<Napi::Number>().Int32Value();
+            m_pool = std::make_shared<InferRequestPool>();
+            m_pool->requests.reserve(jobs);
+            for (size_t handle = 0; handle < jobs; handle++) {
+                m_pool->requests.emplace_back(compiled.create_infer_request());
+                m_pool->idle_handles.push(handle);
+            }
+        }
+
+        m_state = std::make_shared<QueueState>(QueueState{this, nullptr, {}, {}});
 
-        m_requests.reserve(jobs);
+        const auto jobs = m_pool->requests.size();
         m_user_ids.reserve(jobs);
         m_user_inputs.reserve(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
-            m_requests.emplace_back(compiled.create_infer_request());
             m_user_ids.push_back(std::make_pair(Napi::Reference<Napi::Object>::New(Napi::Object::New(env), 1),
                                                 Napi::Promise::Deferred::New(env)));
             m_user_inputs.push_back(Napi::Reference<Napi::Object>::New(Napi::Object::New(env), 1));
-            m_idle_handles.push(handle);
         }
 
     } catch (const ov::Exception& e) {
@@ -56,17 +79,74 @@ AsyncInferQueue::AsyncInferQueue(const Napi::CallbackInfo& info) : Napi::ObjectW
     }
 }
 
+AsyncInferQueue::~AsyncInferQueue() {
+    if (!m_pool || !m_state) {
+        return;
+    }
+    detach_from_pool();
+    // The requests still running are detached from the queue, they are returned to the pool on completion.
+    // The completed ones are returned now, their queued calls may never run if the thread is closing.
+    Napi::ThreadSafeFunction tsfn;
+    std::vector<size_t> completed_handles;
+    {
+        std::lock_guard<std::mutex> lock(m_pool->mutex);
+        tsfn = m_state->tsfn;
+        m_state->tsfn = nullptr;
+        completed_handles.swap(m_state->completed_handles);
+    }
+    if (tsfn) {
+        // The environment may be closing already, the status does not matter then
+        tsfn.Release();
+    }
+    for (const auto handle : completed_handles) {
+        hand_over(m_pool, handle, nullptr);
+    }
+}
+
+void AsyncInferQueue::detach_from_pool() {
+    if (!m_pool || !m_state) {
+        return;
+    }
+    std::vector<size_t> pending_handles;
+    {
+        std::lock_guard<std::mutex> lock(m_pool->mutex);
+        auto& waiters = m_pool->waiters;
+        waiters.erase(std::remove(waiters.begin(), waiters.end(), m_state), waiters.end());
+        pending_handles.swap(m_state->pending_handles);
+    }
+    // The queued calls find no pending handles and do nothing
+    for (const auto handle : pending_handles) {
+        release_handle(handle);
+    }
+}
+
 void AsyncInferQueue::release() {
-    if (m_tsfn) {
-        const auto status = m_tsfn.Release();
+    if (!m_pool || !m_state) {
+        return;
+    }
+    Napi::ThreadSafeFunction tsfn;
+    {
+        // Other threads call the function only under the pool mutex, so nobody calls it after the reset
+        std::lock_guard<std::mutex> lock(m_pool->mutex);
+        tsfn = m_state->tsfn;
+        m_state->tsfn = nullptr;
+    }
+    if (tsfn) {
+        const auto status = tsfn.Release();
         OPENVINO_ASSERT(status == napi_ok, "Failed to release AsyncInferQueue resources.");
-        m_tsfn = nullptr;
     }
 }
 
 void AsyncInferQueue::release(const Napi::CallbackInfo& info) {
     try {
+        // Other queues must not hand requests over to this one anymore
+        detach_from_pool();
         release();
+        while (!m_awaiting_requests.empty()) {
+            std::get<2>(m_awaiting_requests.front())
+                .Reject(Napi::Error::New(info.Env(), "AsyncInferQueue was released.").Value());
+            m_awaiting_requests.pop();
+        }
     } catch (const ov::Exception& e) {
         reportError(info.Env(), e.what());
     }
@@ -79,22 +159,84 @@ Napi::Function AsyncInferQueue::get_class(Napi::Env env) {
                            InstanceMethod("setCallback", &AsyncInferQueue::set_custom_callbacks),
                            InstanceMethod("startAsync", &AsyncInferQueue::start_async),
                            InstanceMethod("release", &AsyncInferQueue::release),
+                           InstanceMethod("share", &AsyncInferQueue::share),
                        });
 }
 
 int AsyncInferQueue::check_idle_request_id() {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    if (m_idle_handles.empty()) {
+    std::lock_guard<std::mutex> lock(m_pool->mutex);
+    if (m_pool->idle_handles.empty()) {
+        // Wait for a request released by any queue which uses the pool
+        m_pool->waiters.push_back(m_state);
         return -1;
     }
-    auto idle_handle = static_cast<int>(m_idle_handles.front());
-    m_idle_handles.pop();
+    auto idle_handle = static_cast<int>(m_pool->idle_handles.front());
+    m_pool->idle_handles.pop();
     return idle_handle;
 }
 
+void AsyncInferQueue::release_handle(const size_t handle) {
+    if (hand_over(m_pool, handle, m_state)) {
+        on_handle_available(handle);
+    }
+}
+
+bool AsyncInferQueue::hand_over(const std::shared_ptr<InferRequestPool>& pool,
+                                const size_t handle,
+                                const std::shared_ptr<QueueState>& self) {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    while (!pool->waiters.empty()) {
+        auto waiter = std::move(pool->waiters.front());
+        pool->waiters.pop_front();
+        if (waiter == self) {
+            return true;
+        }
+        if (!waiter->tsfn) {
+            // The waiter queue is released, it has nothing to start
+            continue;
+        }
+        // The waiter lives in another thread, continue there. The waiter queue is alive while it is
+        // registered in the pool, but it may be released or destroyed before the call runs.
+        waiter->pending_handles.push_back(handle);
+        const auto status = waiter->tsfn.NonBlockingCall([pool, waiter, handle](Napi::Env, Napi::Function) {
+            {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                auto& pending = waiter->pending_handles;
+                const auto it = std::find(pending.begin(), pending.end(), handle);
+                if (it == pending.end()) {
+                    // The queue was released and has returned the request to the pool
+                    return;
+                }
+                pending.erase(it);
+            }
+            // Runs in the thread of the waiter queue, so the queue cannot be destroyed meanwhile
+            waiter->queue->on_handle_available(handle);
+        });
+        if (status == napi_ok) {
+            return false;
+        }
+        // The waiter's thread is closing, try the next one
+        waiter->pending_handles.pop_back();
+    }
+    pool->idle_handles.push(handle);
+    return false;
+}
+
+void AsyncInferQueue::on_handle_available(const size_t handle) {
+    if (m_awaiting_requests.empty()) {
+        release_handle(handle);
+        return;
+    }
+    auto [infer_data, user_data, promise] = std::move(m_awaiting_requests.front());
+    m_awaiting_requests.pop();
+    start_async_impl(handle, infer_data.Value(), user_data.Value(), promise);
+}
+
 void AsyncInferQueue::set_tsfn(Napi::Env env, Napi::Function callback) {
     release();  // release previous ThreadSafeFunction if it exists
-    m_tsfn = Napi::ThreadSafeFunction::New(env, callback, "AsyncInferQueueCallback", 0, 1);
+    auto tsfn = Napi::ThreadSafeFunction::New(env, callback, "AsyncInferQueueCallback", 0, 1);
+    std::lock_guard<std::mutex> lock(m_pool->mutex);
+    m_state->tsfn = tsfn;
 }
 
 void AsyncInferQueue::set_custom_callbacks(const Napi::CallbackInfo& info) {
@@ -105,46 +247,76 @@ void AsyncInferQueue::set_custom_callbacks(const Napi::CallbackInfo& info) {
                         ov::js::get_parameters_error_msg(info, allowed_signatures));
 
         set_tsfn(info.Env(), info[0].As<Napi::Function>());
-        for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            m_requests[handle].set_callback([this, handle](std::exception_ptr exception_ptr) {
-                try {
-                    auto ov_callback = [this, handle, exception_ptr](Napi::Env env, Napi::Function user_callback) {
-                        Napi::Object js_ir = InferRequestWrap::wrap(env, m_requests[handle]);
-                        const auto promise = m_user_ids[handle].second;
-                        try {
-                            if (exception_ptr) {
-                                std::rethrow_exception(exception_ptr);
+    } catch (std::exception& e) {
+        reportError(info.Env(), e.what());
+    }
+}
+
+void AsyncInferQueue::set_request_callback(const size_t handle) {
+    // The request may come from the pool shared with other threads, so the callback is bound to this queue
+    // each time the request is started. The request may complete after the queue is released or destroyed,
+    // so the callback holds the shared state of the queue instead of the queue itself. The pool owns the request,
+    // so it is held weakly.
+    m_pool->requests[handle].set_callback([weak_pool = std::weak_ptr<InferRequestPool>(m_pool),
+                                           state = m_state,
+                                           handle](std::exception_ptr exception_ptr) {
+        const auto pool = weak_pool.lock();
+        if (!pool) {
+            // The request is being destroyed together with the pool
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (state->tsfn) {
+                state->completed_handles.push_back(handle);
+                // The ov_callback will execute when the main event loop will be free
+                const auto status = state->tsfn.NonBlockingCall(
+                    [pool, state, handle, exception_ptr](Napi::Env env, Napi::Function user_callback) {
+                        {
+                            std::lock_guard<std::mutex> lock(pool->mutex);
+                            auto& completed = state->completed_handles;
+                            const auto it = std::find(completed.begin(), completed.end(), handle);
+                            if (it == completed.end()) {
+                                // The queue was destroyed and has returned the request to the pool
+                                return;
                             }
-                            auto user_data =
-                                m_user_ids[handle].first.Value().ToString().Utf8Value() == UNDEFINED_USER_DATA
-                                    ? env.Undefined()
-                                    : m_user_ids[handle].first.Value();
-                            user_callback.Call({env.Null(), js_ir, user_data});
-                            promise.Resolve(user_data);
-                            // returns before the promise's .then() is completed
-                        } catch (const std::exception& e) {
-                            promise.Reject(Napi::Error::New(env, e.what()).Value());
-                        }
-                        // Start async inference on the next request or add idle handle to queue
-                        if (std::lock_guard<std::mutex> lock(m_mutex); m_awaiting_requests.size() > 0) {
-                            const auto& [infer_data, user_data, promise] = m_awaiting_requests.front();
-                            start_async_impl(handle, infer_data.Value(), user_data.Value(), promise);
-                            m_awaiting_requests.pop();
-                        } else {
-                            m_idle_handles.push(handle);
+                            completed.erase(it);
                         }
-                    };
-                    // The ov_callback will execute when the main event loop will be free
-                    napi_status status = m_tsfn.BlockingCall(ov_callback);
-                    OPENVINO_ASSERT(status == napi_ok, "Failed to call user callback.");
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
+                        // Runs in the thread of the queue, so the queue cannot be destroyed meanwhile
+                        state->queue->on_request_completed(env, user_callback, handle, exception_ptr);
+                    });
+                if (status == napi_ok) {
+                    return;
                 }
-            });
+                state->completed_handles.pop_back();
+            }
         }
-    } catch (std::exception& e) {
-        reportError(info.Env(), e.what());
+        // The queue is released or destroyed, nobody waits for the result
+        hand_over(pool, handle, nullptr);
+    });
+}
+
+void AsyncInferQueue::on_request_completed(Napi::Env env,
+                                           Napi::Function user_callback,
+                                           const size_t handle,
+                                           std::exception_ptr exception_ptr) {
+    Napi::Object js_ir = InferRequestWrap::wrap(env, m_pool->requests[handle]);
+    const auto promise = m_user_ids[handle].second;
+    try {
+        if (exception_ptr) {
+            std::rethrow_exception(exception_ptr);
+        }
+        auto user_data = m_user_ids[handle].first.Value().ToString().Utf8Value() == UNDEFINED_USER_DATA
+                             ? env.Undefined()
+                             : m_user_ids[handle].first.Value();
+        user_callback.Call({env.Null(), js_ir, user_data});
+        promise.Resolve(user_data);
+        // returns before the promise's .then() is completed
+    } catch (const std::exception& e) {
+        promise.Reject(Napi::Error::New(env, e.what()).Value());
     }
+    // Start async inference on the next request or add idle handle to queue
+    release_handle(handle);
 }
 
 void AsyncInferQueue::start_async_impl(const size_t handle,
@@ -155,22 +327,25 @@ void AsyncInferQueue::start_async_impl(const size_t handle,
         m_user_inputs[handle] =
             Napi::Persistent(infer_data);  // keep reference to inputs so they are not garbage collected
         m_user_ids[handle] = std::make_pair(Napi::Persistent(user_data), deferred);
+        auto& request = m_pool->requests[handle];
 
         // CVS-166764
         const auto& keys = infer_data.GetPropertyNames();
         for (uint32_t i = 0; i < keys.Length(); ++i) {
             auto input_name = static_cast<Napi::Value>(keys[i]).ToString().Utf8Value();
             auto value = infer_data.Get(input_name);
-            auto tensor = value_to_tensor(value, m_requests[handle], input_name);
+            auto tensor = value_to_tensor(value, request, input_name);
 
-            m_requests[handle].set_tensor(input_name, tensor);
+            request.set_tensor(input_name, tensor);
         }
 
-        OPENVINO_ASSERT(m_tsfn != nullptr,
+        OPENVINO_ASSERT(m_state->tsfn != nullptr,
                         "Callback has to be set before starting inference. Use 'setCallback' method.");
-        m_requests[handle].start_async();  // returns immediately, main event loop is free
+        set_request_callback(handle);
+        request.start_async();  // returns immediately, main event loop is free
     } catch (const std::exception& e) {
         deferred.Reject(Napi::Error::New(infer_data.Env(), e.what()).Value());
+        release_handle(handle);
     }
 }
 
@@ -184,13 +359,20 @@ Napi::Value AsyncInferQueue::start_async(const Napi::CallbackInfo& info) {
                         "'startAsync'",
                         ov::js::get_parameters_error_msg(info, allowed_signatures));
 
-        const auto handle = check_idle_request_id();
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+        if (m_state->tsfn == nullptr) {
+            // Requests handed over by other queues are delivered through the callback's ThreadSafeFunction
+            deferred.Reject(
+                Napi::Error::New(info.Env(),
+                                 "Callback has to be set before starting inference. Use 'setCallback' method.")
+                    .Value());
+            return deferred.Promise();
+        }
         // WA for "Error: Invalid argument" when Napi::Object is undefined.
         auto user_data =
             info.Length() > 1 ? info[1].ToObject() : Napi::String::New(info.Env(), UNDEFINED_USER_DATA).ToObject();
-        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+        const auto handle = check_idle_request_id();
         if (handle == -1) {
-            std::lock_guard<std::mutex> lock(m_mutex);
             m_awaiting_requests.push(
                 std::make_tuple(Napi::Persistent(info[0].ToObject()), Napi::Persistent(user_data), deferred));
         } else {
@@ -203,3 +385,22 @@ Napi::Value AsyncInferQueue::start_async(const Napi::CallbackInfo& info) {
         return info.Env().Undefined();
     }
 }
+
+Napi::Value AsyncInferQueue::share(const Napi::CallbackInfo& info) {
+    if (info.Length() > 0) {
+        reportError(info.Env(), "share() does not accept any arguments.");
+        return info.Env().Undefined();
+    }
+    std::lock_guard<std::mutex> lock(shared_pools_mutex);
+    for (auto it = shared_pools.begin(); it != shared_pools.end();) {
+        it = it->second.expired() ? shared_pools.erase(it) : std::next(it);
+    }
+    for (const auto& [id, pool] : shared_pools) {
+        if (pool.lock() == m_pool) {
+            return Napi::Number::New(info.Env(), id);
+        }
+    }
+    const auto id = next_shared_pool_id++;
+    shared_pools.emplace(id, m_pool);
+    return Napi::Number::New(info.Env(), id);
+}
@@ -46,7 +46,13 @@ TensorImpl::TensorImpl(Napi::Env env,
                        const Napi::TypedArray& typed_array,
                        const ov::element::Type& type,
                        const ov::Shape& shape) {
-    _impl = ov::Tensor(type, shape, typed_array.ArrayBuffer().Data());
+    // Take data pointer from the TypedArray itself: unlike Napi::TypedArray::ArrayBuffer(), it also works for views
+    // over SharedArrayBuffer, so tensors in different worker threads can use one memory without copying.
+    void* data = nullptr;
+    const auto info_status =
+        napi_get_typedarray_info(typed_array.Env(), typed_array, nullptr, nullptr, &data, nullptr, nullptr);
+    OPENVINO_ASSERT(info_status == napi_ok && data != nullptr, "TensorImpl: failed to get TypedArray data.");
+    _impl = ov::Tensor(type, shape, data);
     _strides = _impl.get_strides();
     OPENVINO_ASSERT(_impl.get_byte_size() == typed_array.ByteLength(),
                     "Memory allocated using shape and element::type mismatch TypedArray byte length.");
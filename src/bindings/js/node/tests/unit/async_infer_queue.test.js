@@ -4,8 +4,10 @@
 
 const assert = require("assert");
 const { addon: ov } = require("../..");
+const path = require("path");
+const { Worker } = require("node:worker_threads");
 const { describe, it, before } = require("node:test");
-const { testModels, generateImage } = require("../utils.js");
+const { testModels, generateImage, lengthFromShape } = require("../utils.js");
 
 describe("Tests for AsyncInferQueue.", () => {
   const jobs = 8;
@@ -278,4 +280,185 @@ describe("Tests for AsyncInferQueue.", () => {
       inferQueue.release();
     }
   });
+
+  it("Test share() returns the same id for the queue", () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, numRequest);
+    try {
+      const sharedId = inferQueue.share();
+      assert.strictEqual(typeof sharedId, "number");
+      assert.strictEqual(inferQueue.share(), sharedId);
+      assert.notStrictEqual(new ov.AsyncInferQueue(compiledModel, numRequest).share(), sharedId);
+    } finally {
+      inferQueue.release();
+    }
+  });
+
+  it("Test AsyncInferQueue constructor with unknown shared id", () => {
+    assert.throws(() => {
+      new ov.AsyncInferQueue(4294967295);
+    }, /AsyncInferQueue with shared id 4294967295 does not exist./);
+  });
+
+  it("Test AsyncInferQueue shared with the same thread", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, 1);
+    const sharedQueue = new ov.AsyncInferQueue(inferQueue.share());
+    const finished = [];
+    inferQueue.setCallback((err, request, jobId) => {
+      assert.ifError(err);
+      finished.push(jobId);
+    });
+    sharedQueue.setCallback((err, request, jobId) => {
+      assert.ifError(err);
+      finished.push(jobId);
+    });
+
+    try {
+      // Both queues use one request, so they have to wait for each other
+      await Promise.all([
+        inferQueue.startAsync({ data: generateImage() }, 0),
+        sharedQueue.startAsync({ data: generateImage() }, 1),
+        inferQueue.startAsync({ data: generateImage() }, 2),
+        sharedQueue.startAsync({ data: generateImage() }, 3),
+      ]);
+      assert.deepStrictEqual(
+        finished.sort((a, b) => a - b),
+        [0, 1, 2, 3],
+      );
+    } finally {
+      sharedQueue.release();
+      inferQueue.release();
+    }
+  });
+
+  it("Test request of the pool is not lost when a waiting worker exits", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, 1);
+    const finished = [];
+    inferQueue.setCallback((err, request, jobId) => {
+      assert.ifError(err);
+      finished.push(jobId);
+    });
+    const workerScript = `
+      const { workerData, parentPort } = require("node:worker_threads");
+      const { addon: ov } = require(workerData.addonPath);
+      const queue = new ov.AsyncInferQueue(workerData.sharedId);
+      queue.setCallback(() => {});
+      // Waits for the only request of the pool, which is busy in the main thread.
+      // The input does not fit the model, so the request is returned as soon as the queue receives it.
+      queue.startAsync({ data: new ov.Tensor(ov.element.f32, [1, 2, 3]) }, 0).catch(() => {});
+      parentPort.postMessage("waiting");
+    `;
+
+    try {
+      const busy = inferQueue.startAsync({ data: generateImage() }, 0);
+      const worker = new Worker(workerScript, {
+        eval: true,
+        workerData: {
+          addonPath: path.resolve(__dirname, "../.."),
+          sharedId: inferQueue.share(),
+        },
+      });
+      await new Promise((resolve, reject) => {
+        worker.once("message", resolve);
+        worker.once("error", reject);
+      });
+      // The request may be handed over to the worker queue while it is being destroyed
+      await Promise.all([busy, worker.terminate()]);
+      await Promise.all(
+        Array.from({ length: jobs }, (_, i) => inferQueue.startAsync({ data: generateImage() }, i + 1)),
+      );
+      assert.strictEqual(finished.length, jobs + 1);
+    } finally {
+      inferQueue.release();
+    }
+  });
+
+  it("Test request of the pool is returned when the worker exits during inference", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, 1);
+    const finished = [];
+    inferQueue.setCallback((err, request, jobId) => {
+      assert.ifError(err);
+      finished.push(jobId);
+    });
+    const workerScript = `
+      const { workerData, parentPort } = require("node:worker_threads");
+      const { addon: ov } = require(workerData.addonPath);
+      const queue = new ov.AsyncInferQueue(workerData.sharedId);
+      queue.setCallback(() => {});
+      // Takes the only request of the pool, the worker is terminated before the inference completes
+      const input = new ov.Tensor(ov.element.f32, [1, 3, 32, 32], new Float32Array(workerData.inputLength));
+      queue.startAsync({ data: input }, 0).catch(() => {});
+      parentPort.postMessage("started");
+    `;
+
+    try {
+      const worker = new Worker(workerScript, {
+        eval: true,
+        workerData: {
+          addonPath: path.resolve(__dirname, "../.."),
+          sharedId: inferQueue.share(),
+          inputLength: lengthFromShape([1, 3, 32, 32]),
+        },
+      });
+      await new Promise((resolve, reject) => {
+        worker.once("message", resolve);
+        worker.once("error", reject);
+      });
+      await worker.terminate();
+      // The request completes in the pool without its queue and becomes available again
+      await Promise.all(
+        Array.from({ length: jobs }, (_, i) => inferQueue.startAsync({ data: generateImage() }, i)),
+      );
+      assert.strictEqual(finished.length, jobs);
+    } finally {
+      inferQueue.release();
+    }
+  });
+
+  it("Test AsyncInferQueue shared with worker threads", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, numRequest);
+    inferQueue.setCallback(basicUserCallback);
+    const workersNum = 2;
+    const sharedBuffer = new SharedArrayBuffer(lengthFromShape([1, 3, 32, 32]) * 4);
+    new Float32Array(sharedBuffer).fill(-1.0);
+    const workerScript = `
+      const { workerData, parentPort } = require("node:worker_threads");
+      const { addon: ov } = require(workerData.addonPath);
+      const queue = new ov.AsyncInferQueue(workerData.sharedId);
+      const results = [];
+      queue.setCallback((err, request) => {
+        if (!err) results.push(request.getOutputTensor().getData()[0]);
+      });
+      const input = new ov.Tensor(ov.element.f32, [1, 3, 32, 32], new Float32Array(workerData.sharedBuffer));
+      Promise.all(Array.from({ length: workerData.jobs }, (_, i) => queue.startAsync({ data: input }, i)))
+        .then(() => { queue.release(); parentPort.postMessage(results); });
+    `;
+
+    try {
+      const results = await Promise.all(
+        Array.from(
+          { length: workersNum },
+          () =>
+            new Promise((resolve, reject) => {
+              const worker = new Worker(workerScript, {
+                eval: true,
+                workerData: {
+                  addonPath: path.resolve(__dirname, "../.."),
+                  sharedId: inferQueue.share(),
+                  sharedBuffer,
+                  jobs,
+                },
+              });
+              worker.once("message", resolve);
+              worker.once("error", reject);
+            }),
+        ),
+      );
+      for (const workerResults of results) {
+        // relu(-1.0) read from the shared input buffer
+        assert.deepStrictEqual(workerResults, Array(jobs).fill(0));
+      }
+    } finally {
+      inferQueue.release();
+    }
+  });
 });
@@ -60,6 +60,17 @@ describe("ov.Tensor tests", () => {
     }
   });
 
+  test("Tensor over SharedArrayBuffer shares memory without copying", () => {
+    const sharedBuffer = new SharedArrayBuffer(elemNum * Float32Array.BYTES_PER_ELEMENT);
+    const view = new Float32Array(sharedBuffer);
+    const tensor = new ov.Tensor(ov.element.f32, shape, view);
+    const otherTensor = new ov.Tensor(ov.element.f32, shape, new Float32Array(sharedBuffer));
+
+    view[0] = 42.0;
+    assert.strictEqual(tensor.getData()[0], 42.0);
+    assert.strictEqual(otherTensor.getData()[0], 42.0);
+  });
+
   describe("Tensor data", () => {
     it("set tensor data with element type", () => {
       params.forEach(([type, , data]) => {
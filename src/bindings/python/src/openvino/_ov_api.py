@@ -2,6 +2,7 @@
 # Copyright (C) 2018-2026 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import asyncio
 import io
 from types import TracebackType
 from typing import Any, Union, Optional
@@ -274,6 +275,78 @@ class InferRequest(_InferRequestWrapper):
             userdata,
         )
 
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = False,
+        share_outputs: bool = False,
+        *,
+        decode_strings: bool = True,
+    ) -> OVDict:
+        """Infers specified input(s) in asynchronous mode and awaits the results.
+
+        Native `asyncio` counterpart of `infer`. The inference is started with
+        `start_async` and the awaiting coroutine is resumed by the OpenVINO callback
+        through `loop.call_soon_threadsafe`, so no additional thread is used per request.
+
+        Cancelling the awaiting task cancels the inference request.
+
+        Note: the method replaces any callback previously set with `set_callback`.
+        Calling any method on the `InferRequest` object while the request is running
+        will lead to throwing exceptions.
+
+        :param inputs: Data to be set on input tensors.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode, see `infer` for details.
+
+                              Default value: False
+        :type share_inputs: bool, optional
+        :param share_outputs: Enables `share_outputs` mode, see `infer` for details.
+
+                              Default value: False
+        :type share_outputs: bool, optional
+        :param decode_strings: Controls decoding outputs of textual based data.
+
+                               Default value: True
+        :type decode_strings: bool, optional, keyword-only
+        :return: Dictionary of results from output tensors with port/int/str keys.
+        :rtype: OVDict
+        """
+        loop = asyncio.get_running_loop()
+        future = loop.create_future()
+
+        def resolve(error: Optional[str]) -> None:
+            if future.done():
+                return
+            if error is None:
+                future.set_result(None)
+            else:
+                future.set_exception(RuntimeError(error))
+
+        # Called from OpenVINO callback executor, wakes up the event loop
+        def on_complete(error: Optional[str]) -> None:
+            try:
+                loop.call_soon_threadsafe(resolve, error)
+            except RuntimeError:
+                # The event loop has been closed meanwhile, nobody awaits the result anymore
+                pass
+
+        super()._set_completion_callback(on_complete)
+        super().start_async(
+            _data_dispatch(
+                self,
+                inputs,
+                is_shared=share_inputs,
+            ),
+            None,
+        )
+        try:
+            await future
+        except asyncio.CancelledError:
+            self.cancel()
+            raise
+        return OVDict(super()._get_results(share_outputs, decode_strings))
+
     def get_compiled_model(self) -> "CompiledModel":
         """Gets the compiled model this InferRequest is using.
 
@@ -302,6 +375,8 @@ class CompiledModel(CompiledModelBase):
     def __init__(self, other: CompiledModelBase, weights: Optional[bytes] = None) -> None:
         # Private memeber to store already created InferRequest
         self._infer_request: Optional[InferRequest] = None
+        # Private member to store idle InferRequests used by `infer_async`
+        self._async_requests: list[InferRequest] = []
         self._weights = weights
         super().__init__(other)
 
@@ -474,6 +549,53 @@ class CompiledModel(CompiledModelBase):
             decode_strings=decode_strings,
         )
 
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = True,
+        share_outputs: bool = False,
+        *,
+        decode_strings: bool = True,
+    ) -> OVDict:
+        """Infers specified input(s) in asynchronous mode and awaits the results.
+
+        Native `asyncio` counterpart of `__call__`. Requests are taken from an internal
+        pool, which grows when several coroutines await the results concurrently,
+        and are returned to the pool after completion.
+
+        Cancelling the awaiting task cancels the inference. The cancelled request
+        is not returned to the pool.
+
+        :param inputs: Data to be set on input tensors.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode, see `__call__` for details.
+
+                              Default value: True
+        :type share_inputs: bool, optional
+        :param share_outputs: Enables `share_outputs` mode, see `__call__` for details.
+
+                              Note: returned data is valid only until the request
+                              is reused by the next `infer_async` call.
+
+                              Default value: False
+        :type share_outputs: bool, optional
+        :param decode_strings: Controls decoding outputs of textual based data.
+
+                               Default value: True
+        :type decode_strings: bool, optional, keyword-only
+        :return: Dictionary of results from output tensors with port/int/str as keys.
+        :rtype: OVDict
+        """
+        request = self._async_requests.pop() if self._async_requests else self.create_infer_request()
+        results = await request.infer_async(
+            inputs,
+            share_inputs=share_inputs,
+            share_outputs=share_outputs,
+            decode_strings=decode_strings,
+        )
+        self._async_requests.append(request)
+        return results
+
 
 class AsyncInferQueue(AsyncInferQueueBase):
     """AsyncInferQueue with a pool of asynchronous requests.
@@ -222,6 +222,21 @@ class CompiledModel(openvino._pyopenvino.CompiledModel):
         """
     def get_runtime_model(self) -> Model:
         ...
+    async def infer_async(self, inputs: typing.Any = None, share_inputs: bool = True, share_outputs: bool = False, *, decode_strings: bool = True) -> openvino.utils.data_helpers.wrappers.OVDict:
+        """
+        Infers specified input(s) in asynchronous mode and awaits the results.
+        
+                Native `asyncio` counterpart of `__call__`. Requests are taken from an internal
+                pool, which grows when several coroutines await the results concurrently,
+                and are returned to the pool after completion.
+        
+                Cancelling the awaiting task cancels the inference. The cancelled request
+                is not returned to the pool.
+        
+                :return: Dictionary of results from output tensors with port/int/str as keys.
+                :rtype: OVDict
+                
+        """
     def infer_new_request(self, inputs: typing.Any = None) -> openvino.utils.data_helpers.wrappers.OVDict:
         """
         Infers specified input(s) in synchronous mode.
@@ -442,6 +457,20 @@ class InferRequest(openvino.utils.data_helpers.wrappers._InferRequestWrapper):
                 :return: Dictionary of results from output tensors with port/int/str keys.
                 :rtype: OVDict
                 
+        """
+    async def infer_async(self, inputs: typing.Any = None, share_inputs: bool = False, share_outputs: bool = False, *, decode_strings: bool = True) -> openvino.utils.data_helpers.wrappers.OVDict:
+        """
+        Infers specified input(s) in asynchronous mode and awaits the results.
+        
+                Native `asyncio` counterpart of `infer`. The inference is started with
+                `start_async` and the awaiting coroutine is resumed by the OpenVINO callback
+                through `loop.call_soon_threadsafe`, so no additional thread is used per request.
+        
+                Cancelling the awaiting task cancels the inference request.
+        
+                :return: Dictionary of results from output tensors with port/int/str keys.
+                :rtype: OVDict
+                
         """
     def start_async(self, inputs: typing.Any = None, userdata: typing.Any = None, share_inputs: bool = False) -> None:
         """
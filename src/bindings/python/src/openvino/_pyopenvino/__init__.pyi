@@ -86,6 +86,30 @@ class AsyncInferQueue:
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
         """
+    def set_batched_callback(self, callback: collections.abc.Callable, max_batch_size: typing.SupportsInt | typing.SupportsIndex = 0) -> None:
+        """
+                    Sets unified callback on all InferRequests from queue's pool which
+                    receives finished requests in batches.
+        
+                    Requests that complete while the callback is running are accumulated
+                    and delivered with the next call, so the GIL is acquired once per batch
+                    instead of once per request. Signature of such function should have one
+                    argument: a list of (InferRequest, userdata) pairs.
+        
+                    .. code-block:: python
+        
+                        def f(completed):
+                            for request, userdata in completed:
+                                print(request.output_tensors[0] + userdata)
+        
+                        async_infer_queue.set_batched_callback(f)
+        
+                    :param callback: Any Python defined function that matches callback's requirements.
+                    :type callback: function
+                    :param max_batch_size: Maximum number of requests passed to a single callback call.
+                    If 0, it is equal to the number of InferRequests in a pool. Default: 0
+                    :type max_batch_size: int
+        """
     @typing.overload
     def start_async(self, inputs: Tensor, userdata: typing.Any) -> None:
         """
@@ -17,6 +17,9 @@ class Constant(openvino._pyopenvino.Node):
     def __init__(self, array: numpy.ndarray[typing.Any, numpy.dtype[typing.Any]], shared_memory: bool = False) -> None:
         ...
     @typing.overload
+    def __init__(self, array: numpy.ndarray[typing.Any, numpy.dtype[typing.Any]], type: openvino._pyopenvino.Type, shared_memory: bool = False) -> None:
+        ...
+    @typing.overload
     def __init__(self, tensor: openvino._pyopenvino.Tensor, shared_memory: bool = True) -> None:
         ...
     @typing.overload
@@ -15,6 +15,7 @@ from openvino.frontend.pytorch.py_pytorch_frontend import (
 )
 from openvino import op, PartialShape, Type as OVType, OVAny
 from openvino.frontend.pytorch.utils import (
+    ConstantStatistics,
     ivalue_to_constant,
     get_value_from_getattr,
     pt_to_ov_type_map,
@@ -48,6 +49,7 @@ class TorchScriptPythonDecoder(Decoder):
         skip_freeze=False,
         constant_cache=None,
         module_extensions=None,
+        constant_statistics=None,
         trace_kwargs=None,
     ):
         super().__init__()
@@ -58,6 +60,8 @@ class TorchScriptPythonDecoder(Decoder):
         self._shared_memory = shared_memory
         self._input_is_list = False
         self.constant_cache = constant_cache if constant_cache is not None else dict()  # noqa: C408
+        # amount of torch weights memory shared with or copied to the converted model
+        self.constant_statistics = constant_statistics if constant_statistics is not None else ConstantStatistics()
         self.module_extensions = module_extensions
         self.config = None
         self.out_debug_name_overwrites = {}
@@ -312,6 +316,7 @@ class TorchScriptPythonDecoder(Decoder):
                 shared_memory=self._shared_memory,
                 constant_cache=self.constant_cache,
                 module_extensions=self.module_extensions,
+                constant_statistics=self.constant_statistics,
             )
             self.m_decoders.append(decoder)
             node_visitor(decoder)
@@ -344,7 +349,8 @@ class TorchScriptPythonDecoder(Decoder):
                                            self.get_subgraphs()[index],
                                            alias_db=self.alias_db,
                                            shared_memory=self._shared_memory,
-                                           module_extensions=self.module_extensions
+                                           module_extensions=self.module_extensions,
+                                           constant_statistics=self.constant_statistics,
                                            )
         self.m_decoders.append(decoder)
         return decoder
@@ -427,7 +433,7 @@ class TorchScriptPythonDecoder(Decoder):
             if w_name in self.constant_cache:
                 res = self.constant_cache[w_name][0]
             else:
-                res = convert_quantized_tensor(weight, self._shared_memory)
+                res = convert_quantized_tensor(weight, self._shared_memory, self.constant_statistics)
                 self._add_name_to_const_and_cache(res, w_name)
 
             if isinstance(bias, torch.Tensor):
@@ -435,7 +441,7 @@ class TorchScriptPythonDecoder(Decoder):
                 if b_name in self.constant_cache:
                     res += self.constant_cache[b_name][0]
                 else:
-                    b_res = ivalue_to_constant(bias)
+                    b_res = ivalue_to_constant(bias, statistics=self.constant_statistics)
                     self._add_name_to_const_and_cache(b_res, b_name)
                     res += b_res
             else:
@@ -467,7 +473,7 @@ class TorchScriptPythonDecoder(Decoder):
                 if hasattr(pt_value, "dtype") and pt_value.dtype.is_complex:
                     pt_value = torch.view_as_real(pt_value)
                 const = ivalue_to_constant(
-                    pt_value, shared_memory=self._shared_memory)
+                    pt_value, shared_memory=self._shared_memory, statistics=self.constant_statistics)
                 self._add_name_to_const_and_cache(const, name, dtype)
             if dtype is not None:
                 self.cached_out_types = [dtype]
@@ -483,7 +489,9 @@ class TorchScriptPythonDecoder(Decoder):
         pt_value = self._raw_output(0)
         pt_type = pt_value.type()
         if isinstance(pt_type, torch.TensorType):
-            return ivalue_to_constant(pt_value.toIValue(), shared_memory=self._shared_memory)
+            return ivalue_to_constant(pt_value.toIValue(),
+                                      shared_memory=self._shared_memory,
+                                      statistics=self.constant_statistics)
         if isinstance(pt_type, torch.ListType):
             return self._as_constant_list(pt_value)
         if isinstance(pt_type, torch._C.Type) and pt_type.annotation_str == "Generator":
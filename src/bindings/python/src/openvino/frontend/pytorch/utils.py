@@ -59,7 +59,21 @@ F8_DTYPE_MAP = {
 }
 
 
-def torch_tensor_to_ov_const(torch_t: torch.Tensor, shared_memory=True):
+class ConstantStatistics:
+    """Accumulates the amount of torch tensor memory shared with or copied to OpenVINO Constants."""
+
+    def __init__(self):
+        self.shared_bytes = 0
+        self.copied_bytes = 0
+
+    def add(self, nbytes: int, copied: bool):
+        if copied:
+            self.copied_bytes += nbytes
+        else:
+            self.shared_bytes += nbytes
+
+
+def torch_tensor_to_ov_const(torch_t: torch.Tensor, shared_memory=True, statistics=None):
     try:
         from torch._prims import FakeTensor
         if isinstance(torch_t, FakeTensor):
@@ -69,19 +83,17 @@ def torch_tensor_to_ov_const(torch_t: torch.Tensor, shared_memory=True):
         log.debug("Failed to import FakeTensor")
 
     dtype = torch_t.dtype
+    src_data_ptr = torch_t.data_ptr()
     torch_t = torch_t.contiguous()
     if dtype == torch.bfloat16:
-        # reinterpret bfloat16 data as float16 to allow conversion to numpy
-        torch_t = torch_t.view(torch.float16)
-        narr = torch_t.numpy(force=True)
-        tensor = Tensor(narr, torch_t.shape, OVType.bf16)
-        ov_const = op.Constant(tensor, shared_memory=shared_memory)
+        # reinterpret bfloat16 data as float16 to allow conversion to numpy,
+        # the constant keeps the array and so the torch storage alive
+        narr = torch_t.view(torch.float16).numpy(force=True)
+        ov_const = op.Constant(narr, OVType.bf16, shared_memory=shared_memory)
     elif dtype in F8_DTYPE_MAP:
         # reinterpret f8 data as u8 to allow conversion to numpy
-        torch_t = torch_t.view(torch.uint8)
-        narr = torch_t.numpy(force=True)
-        tensor = Tensor(narr, torch_t.shape, F8_DTYPE_MAP[dtype])
-        ov_const = op.Constant(tensor, shared_memory=shared_memory)
+        narr = torch_t.view(torch.uint8).numpy(force=True)
+        ov_const = op.Constant(narr, F8_DTYPE_MAP[dtype], shared_memory=shared_memory)
     elif torch_t.is_complex():
         narr = torch.view_as_real(torch_t).numpy(force=True)
         # we rely on frontend to mark the constant as complex internally
@@ -89,10 +101,14 @@ def torch_tensor_to_ov_const(torch_t: torch.Tensor, shared_memory=True):
     else:
         narr = torch_t.numpy(force=True)
         ov_const = op.Constant(narr, shared_memory=shared_memory)
+    if statistics is not None:
+        # non-contiguous, non-CPU or conjugated tensors are materialized before sharing
+        copied = not shared_memory or narr.size > 0 and narr.ctypes.data != src_data_ptr
+        statistics.add(narr.nbytes, copied)
     return ov_const
 
 
-def ivalue_to_constant(ivalue, shared_memory=True):
+def ivalue_to_constant(ivalue, shared_memory=True, statistics=None):
     ov_type = get_type_from_py_type(ivalue)
     if ov_type.is_static():
         if isinstance(ivalue, complex):
@@ -107,7 +123,7 @@ def ivalue_to_constant(ivalue, shared_memory=True):
         return op.Constant(ov_type, Shape([len(ivalue)]), ivalue).outputs()
 
     if isinstance(ivalue, torch.Tensor):
-        return torch_tensor_to_ov_const(ivalue, shared_memory=shared_memory).outputs()
+        return torch_tensor_to_ov_const(ivalue, shared_memory=shared_memory, statistics=statistics).outputs()
     return None
 
 
@@ -277,10 +293,13 @@ def prepare_example_inputs_and_model(inputs, input_params, model):
     return {"example_inputs": inputs}, input_signature, model, input_is_list
 
 
-def convert_quantized_tensor(qtensor: torch.Tensor, shared_memory: bool):
+def convert_quantized_tensor(qtensor: torch.Tensor, shared_memory: bool, statistics=None):
     # represents torch quantized tensor as
     # Constant(u8) -> Convert(f32) -> Subtract(zero_point) -> Multiply(scale)
     qscheme = qtensor.qscheme()
+    if statistics is not None:
+        # torch has no view of the integer representation, int_repr() always copies
+        statistics.add(qtensor.numel() * qtensor.element_size(), True)
     if qscheme == torch.per_channel_affine:
         int8_tensor = qtensor.int_repr()
         scale = qtensor.q_per_channel_scales().numpy().astype(np.float32)
@@ -293,7 +312,7 @@ def convert_quantized_tensor(qtensor: torch.Tensor, shared_memory: bool):
         scale_bc = np.reshape(scale, new_shape)
 
         int8_const = torch_tensor_to_ov_const(
-            int8_tensor, shared_memory=shared_memory)
+            int8_tensor, shared_memory=True)
         convert = ops.convert(int8_const, np.float32)
         sub = ops.subtract(convert, zero_point_bc)
         return ops.multiply(sub, scale_bc).outputs()
@@ -303,7 +322,7 @@ def convert_quantized_tensor(qtensor: torch.Tensor, shared_memory: bool):
         zero_point = np.float32(qtensor.q_zero_point())
 
         int8_const = torch_tensor_to_ov_const(
-            int8_tensor, shared_memory=shared_memory)
+            int8_tensor, shared_memory=True)
         convert = ops.convert(int8_const, np.float32)
         sub = ops.subtract(convert, zero_point)
         return ops.multiply(sub, scale).outputs()
@@ -6,8 +6,11 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,6 +22,101 @@
 
 namespace py = pybind11;
 
+// Bounded multi-producer/multi-consumer ring of request handles.
+// Every slot carries a sequence number, so push and pop only need a single CAS on
+// the corresponding cursor and never take a lock. The capacity is rounded up to
+// a power of two and is never smaller than the number of handles in the pool,
+// thus push cannot fail for AsyncInferQueue usage.
+class HandleRing {
+public:
+    // Not thread-safe, must be called before the ring is shared between threads.
+    void reset(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_relaxed);
+    }
+
+    bool push(size_t value) {
+        Cell* cell = nullptr;
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(size_t& value) {
+        Cell* cell = nullptr;
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+        value = cell->value;
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Reads the oldest element without removing it. The result is only stable
+    // while no other thread pops from the ring.
+    bool front(size_t& value) const {
+        const size_t pos = m_head.load(std::memory_order_relaxed);
+        const Cell& cell = m_cells[pos & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        value = cell.value;
+        return true;
+    }
+
+    bool empty() const {
+        size_t value;
+        return !front(value);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        size_t value = 0;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+};
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
@@ -26,6 +124,8 @@ public:
             jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
         }
 
+        m_idle_handles.reset(jobs);
+        m_completed_handles.reset(jobs);
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
 
@@ -47,27 +147,18 @@ public:
     bool _is_ready() {
         // Check if any request has finished already
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return !(m_idle_handles.empty());
+        this->rethrow_first_error();
+        return !m_idle_handles.empty();
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
+        size_t idle_handle = this->wait_for_idle_handle();
         // wait for request to make sure it returned from callback
         m_requests[idle_handle].m_request.wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        this->rethrow_first_error();
         return idle_handle;
     }
 
@@ -78,10 +169,7 @@ public:
         for (auto&& request : m_requests) {
             request.m_request.wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        this->rethrow_first_error();
     }
 
     void set_default_callbacks() {
@@ -90,14 +178,8 @@ public:
 
             m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                // Add idle handle to queue and notify waiters in get_idle_request_id()
+                this->release_handle(handle);
 
                 try {
                     if (exception_ptr) {
@@ -128,20 +210,38 @@ public:
                         // performing PyErr_Fetch which clears error indicator and
                         // saves it inside itself.
                         assert(py_error.type());
-                        // acquire the mutex to access m_errors
-                        std::lock_guard<std::mutex> lock(m_mutex);
-                        m_errors.push(py_error);
+                        this->push_error(py_error);
                     }
                 }
 
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
+                // Add idle handle to queue and notify waiters in get_idle_request_id()
+                this->release_handle(handle);
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
+    void set_batched_callbacks(py::function f_callback, size_t max_batch_size) {
+        // need to acquire GIL before py::function deletion
+        auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
+        m_max_batch_size = max_batch_size == 0 ? m_requests.size() : max_batch_size;
+
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    m_completed_handles.push(handle);
+                    this->dispatch_completed(*callback_sp, handle);
+                } else {
+                    this->release_handle(handle);
                 }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
 
                 try {
                     if (exception_ptr) {
@@ -154,13 +254,114 @@ public:
         }
     }
 
+    // Delivers finished requests to Python in batches. Only one thread dispatches at a time,
+    // the other callbacks just leave their handles in m_completed_handles and return, so
+    // requests finished while the Python callback runs are delivered under one GIL acquisition.
+    void dispatch_completed(py::function& callback, size_t own_handle) {
+        bool own_handle_dispatched = false;
+        // make the push to m_completed_handles visible before trying to become a dispatcher
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!m_dispatching.exchange(true)) {
+            {
+                // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
+                py::gil_scoped_acquire acquire;
+                std::vector<size_t> batch;
+                batch.reserve(m_max_batch_size);
+                size_t handle;
+                while (batch.size() < m_max_batch_size && m_completed_handles.pop(handle)) {
+                    batch.push_back(handle);
+                }
+                if (!batch.empty()) {
+                    py::list completed;
+                    for (auto&& completed_handle : batch) {
+                        completed.append(py::make_tuple(m_requests[completed_handle], m_user_ids[completed_handle]));
+                    }
+                    try {
+                        callback(completed);
+                    } catch (const py::error_already_set& py_error) {
+                        assert(py_error.type());
+                        this->push_error(py_error);
+                    }
+                }
+                for (auto&& completed_handle : batch) {
+                    // Own handle is released last: the request is not reusable
+                    // until this callback returns anyway.
+                    if (completed_handle == own_handle) {
+                        own_handle_dispatched = true;
+                    } else {
+                        this->release_handle(completed_handle);
+                    }
+                }
+            }
+            m_dispatching.store(false);
+            // Pick up completions pushed by callbacks that found the dispatcher busy
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_completed_handles.empty()) {
+                break;
+            }
+        }
+        if (own_handle_dispatched) {
+            this->release_handle(own_handle);
+        }
+    }
+
+    size_t wait_for_idle_handle() {
+        size_t handle;
+        if (m_idle_handles.front(handle)) {
+            return handle;
+        }
+        // Slow path: sleep until one of the callbacks returns a handle to the ring
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cv.wait(lock, [this, &handle] {
+            return m_idle_handles.front(handle);
+        });
+        m_waiters.fetch_sub(1);
+        return handle;
+    }
+
+    void release_handle(size_t handle) {
+        m_idle_handles.push(handle);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load() > 0) {
+            // acquire the mutex so notification cannot be lost between predicate check and wait
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+    void push_error(const py::error_already_set& py_error) {
+        // acquire the mutex to access m_errors
+        std::lock_guard<std::mutex> lock(m_errors_mutex);
+        m_errors.push(py_error);
+        m_has_errors.store(true, std::memory_order_release);
+    }
+
+    void rethrow_first_error() {
+        if (!m_has_errors.load(std::memory_order_acquire)) {
+            return;
+        }
+        // acquire the mutex to access m_errors
+        std::lock_guard<std::mutex> lock(m_errors_mutex);
+        if (m_errors.size() > 0)
+            throw m_errors.front();
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
+    HandleRing m_idle_handles;
+    HandleRing m_completed_handles;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
+    // m_mutex and m_cv are only used to sleep when no idle handle is available
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    std::atomic<size_t> m_waiters{0};
+    std::atomic<bool> m_dispatching{false};
+    size_t m_max_batch_size = 1;
+    std::mutex m_errors_mutex;
+    std::atomic<bool> m_has_errors{false};
     std::queue<py::error_already_set> m_errors;
 };
 
@@ -190,10 +391,7 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            self.m_idle_handles.pop(handle);
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -236,10 +434,7 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            self.m_idle_handles.pop(handle);
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -321,6 +516,34 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batched_callback",
+            &AsyncInferQueue::set_batched_callbacks,
+            py::arg("callback"),
+            py::arg("max_batch_size") = 0,
+            R"(
+            Sets unified callback on all InferRequests from queue's pool which
+            receives finished requests in batches.
+
+            Requests that complete while the callback is running are accumulated
+            and delivered with the next call, so the GIL is acquired once per batch
+            instead of once per request. Signature of such function should have one
+            argument: a list of (InferRequest, userdata) pairs.
+
+            .. code-block:: python
+
+                def f(completed):
+                    for request, userdata in completed:
+                        print(request.output_tensors[0] + userdata)
+
+                async_infer_queue.set_batched_callback(f)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param max_batch_size: Maximum number of requests passed to a single callback call.
+            If 0, it is equal to the number of InferRequests in a pool. Default: 0
+            :type max_batch_size: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
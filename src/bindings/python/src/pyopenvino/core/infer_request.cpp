@@ -460,6 +460,66 @@ void regclass_InferRequest(py::module m) {
             :type userdata: Any
         )");
 
+    // Python API exclusive function, used to complete awaitables of `infer_async`
+    cls.def(
+        "_set_completion_callback",
+        [](InferRequestWrapper& self, py::function callback) {
+            // need to acquire GIL before py::function deletion
+            auto callback_sp = Common::utils::wrap_pyfunction(std::move(callback));
+
+            self.m_request.set_callback([&self, callback_sp](std::exception_ptr exception_ptr) {
+                *self.m_end_time = Time::now();
+                std::string error;
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    error = e.what();
+                }
+                // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
+                py::gil_scoped_acquire acquire;
+                try {
+                    if (exception_ptr) {
+                        (*callback_sp)(py::str(error));
+                    } else {
+                        (*callback_sp)(py::none());
+                    }
+                } catch (py::error_already_set& py_error) {
+                    // there is no Python frame to propagate the error to on the callback executor thread
+                    py_error.discard_as_unraisable("InferRequest completion callback");
+                }
+            });
+        },
+        py::arg("callback"),
+        R"(
+            Sets a callback function that will be called on completion of asynchronous InferRequest.
+            Unlike `set_callback`, the function is called on failure as well and receives
+            the error message, or None if inference succeeded.
+
+            :param callback: Function defined in Python.
+            :type callback: function
+        )");
+
+    // Python API exclusive function
+    cls.def(
+        "_get_results",
+        [](InferRequestWrapper& self, bool share_outputs, bool decode_strings) {
+            return Common::outputs_to_dict(self, share_outputs, decode_strings);
+        },
+        py::arg("share_outputs"),
+        py::arg("decode_strings"),
+        R"(
+            Gets all outputs tensors of this InferRequest.
+
+            :param share_outputs: If set to True, results are returned as views of output Tensors.
+            :type share_outputs: bool
+            :param decode_strings: If set to True, string outputs are decoded.
+            :type decode_strings: bool
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: dict[openvino.ConstOutput, numpy.array]
+        )");
+
     cls.def(
         "get_tensor",
         [](InferRequestWrapper& self, const std::string& name) {
@@ -67,6 +67,26 @@ void regclass_graph_op_Constant(py::module m) {
                  }),
                  py::arg("array"),
                  py::arg("shared_memory") = false);
+    // Numpy-based constructor which reinterprets the array data as the given element type,
+    // e.g. bf16 or f8 data that numpy can only hold as f16 or u8 arrays
+    constant.def(py::init([](py::array& array, const ov::element::Type& type, bool shared_memory) {
+                     OPENVINO_ASSERT(type.bitwidth() == static_cast<size_t>(array.itemsize()) * 8,
+                                     "Element type ",
+                                     type,
+                                     " doesn't match the array item size ",
+                                     array.itemsize());
+                     const auto shape = Common::array_helpers::get_shape(array);
+                     if (shared_memory) {
+                         return ov::op::v0::Constant(type, shape, Common::constant_helpers::get_shared_memory(array));
+                     }
+                     if (!Common::array_helpers::is_contiguous(array)) {
+                         array = Common::array_helpers::as_contiguous(array, Common::type_helpers::get_ov_type(array));
+                     }
+                     return ov::op::v0::Constant(type, shape, array.data());
+                 }),
+                 py::arg("array"),
+                 py::arg("type"),
+                 py::arg("shared_memory") = false);
     // Tensor-based constructors
     constant.def(py::init([](ov::Tensor& tensor, bool shared_memory) {
                      return Common::object_from_data<ov::op::v0::Constant>(tensor, shared_memory);
@@ -2,6 +2,7 @@
 # Copyright (C) 2018-2026 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import asyncio
 from collections.abc import Iterable
 from copy import deepcopy
 import numpy as np
@@ -188,6 +189,82 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("max_batch_size", [0, 1, 3])
+def test_infer_queue_batched_callback(device, max_batch_size):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [False for _ in range(jobs)]
+    batch_sizes = []
+
+    def callback(completed):
+        batch_sizes.append(len(completed))
+        for request, job_id in completed:
+            assert request.latency > 0
+            jobs_done[job_id] = True
+
+    img = generate_image()
+    infer_queue.set_batched_callback(callback, max_batch_size)
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+
+    assert all(jobs_done)
+    assert sum(batch_sizes) == jobs
+    limit = num_request if max_batch_size == 0 else max_batch_size
+    assert all(0 < size <= limit for size in batch_sizes)
+
+
+def test_infer_queue_batched_callback_fail_on_py_model(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(completed):
+        completed = completed + 21
+
+    img = generate_image()
+    infer_queue.set_batched_callback(callback)
+
+    with pytest.raises(TypeError) as e:
+        infer_queue.start_async({"data": img})
+        infer_queue.wait_all()
+
+    assert "can only concatenate list" in str(e.value)
+
+
+def test_infer_queue_batched_callback_delivery(device):
+    # The first callback holds the dispatcher while the other requests finish,
+    # so their completions have to be delivered together by the next call.
+    num_request = 8
+    core = Core()
+    param = ops.parameter([8], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    data = np.arange(8, dtype=np.float32)
+
+    calls = []
+
+    def callback(completed):
+        if not calls:
+            time.sleep(1)
+        calls.append([job_id for _, job_id in completed])
+
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    infer_queue.set_batched_callback(callback)
+    for i in range(num_request):
+        infer_queue.start_async({0: data}, i)
+    infer_queue.wait_all()
+
+    assert sorted(job_id for batch in calls for job_id in batch) == list(range(num_request))
+    assert len(calls) < num_request
+    assert max(len(batch) for batch in calls) > 1
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_results_async_infer(device, share_inputs):
     jobs = 8
@@ -381,3 +458,90 @@ def test_array_like_input_async(device, share_inputs):
     request.start_async(model_input_list)
     request.wait()
     assert np.array_equal(request.get_output_tensor().data, np.abs(input_data))
+
+
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_async_awaitable(device, share_inputs):
+    _, request, _, array1 = generate_abs_compiled_model_with_data(device, Type.f32, np.single)
+
+    async def main():
+        return await request.infer_async(array1, share_inputs=share_inputs)
+
+    results = asyncio.run(main())
+    assert np.array_equal(results[0], np.abs(array1))
+    assert request.latency > 0
+
+
+def test_infer_async_compiled_model_concurrent(device):
+    compiled_model, _, _, array1 = generate_abs_compiled_model_with_data(device, Type.f32, np.single)
+    jobs = 16
+
+    async def main():
+        return await asyncio.gather(*(compiled_model.infer_async(array1 * i) for i in range(jobs)))
+
+    results = asyncio.run(main())
+    for i, result in enumerate(results):
+        assert np.array_equal(result[0], np.abs(array1 * i))
+    # Requests are returned to the pool after completion
+    assert 0 < len(compiled_model._async_requests) <= jobs
+
+
+@skip_need_mock_op
+def test_infer_async_fail_in_inference(device):
+    core = Core()
+    data = ops.parameter([10], dtype=np.float32, name="data")
+    k_op = ops.parameter(Shape([]), dtype=np.int32, name="k")
+    emb = ops.topk(data, k_op, axis=0, mode="max", sort="value")
+    model = Model(emb, [data, k_op])
+    request = core.compile_model(model, device).create_infer_request()
+
+    async def main():
+        await request.infer_async({"data": np.arange(10).astype(np.float32), "k": np.array(11, dtype=np.int32)})
+
+    with pytest.raises(RuntimeError) as e:
+        asyncio.run(main())
+    assert "Can not clone with new dims" in str(e.value)
+
+
+def test_infer_async_cancel_before_start(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    img = generate_image()
+    request = compiled_model.create_infer_request()
+
+    async def main():
+        task = asyncio.ensure_future(request.infer_async({0: img}))
+        # the coroutine has not run yet, so the request is never started
+        task.cancel()
+        with pytest.raises(asyncio.CancelledError):
+            await task
+        assert task.cancelled()
+
+    asyncio.run(main())
+    assert request.wait_for(0)
+    assert np.allclose(list(request.infer({0: img}).values())[0], np.maximum(img, 0))
+
+
+def test_infer_async_cancel(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    img = generate_image()
+    request = compiled_model.create_infer_request()
+    cancel_calls = []
+    request.cancel = lambda: cancel_calls.append(True)
+
+    async def main():
+        task = asyncio.ensure_future(request.infer_async({0: img}))
+        # the request is started by the first step of the task, which is scheduled before this coroutine resumes;
+        # its completion is delivered through the event loop, so it cannot resolve the task before the cancellation
+        await asyncio.sleep(0)
+        task.cancel()
+        with pytest.raises(asyncio.CancelledError):
+            await task
+        assert task.cancelled()
+
+    asyncio.run(main())
+    assert cancel_calls == [True]
+    request.wait()
@@ -162,10 +162,13 @@ public:
 
     /*** Updates every registered KernelExecutor in accordance with the corresponding expression */
     void update_state(const lowered::LinearIRCPtr& linear_ir) const {
-        for (const auto& expr : *linear_ir) {
+        size_t updated = 0;
+        for (auto expr_it = linear_ir->begin(); expr_it != linear_ir->end() && updated < m_table.size(); ++expr_it) {
+            const auto& expr = *expr_it;
             const auto& found = m_table.find(expr->get_exec_num());
             if (found != m_table.end()) {
                 found->second->update_by_expression(expr, linear_ir);
+                updated++;
             }
         }
     }
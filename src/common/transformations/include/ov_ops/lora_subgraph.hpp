@@ -19,6 +19,9 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): per batch row index of the adapter to apply. In this case `LoRA_matrices` hold
+ *    the stacked matrices of all the loaded adapters along the leading dimension, and the body selects them
+ *    with Gather(axis = 0) before applying, so adapters may be added or removed by resetting the states.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -21,5 +21,10 @@ class TRANSFORMATIONS_API LoraSubgraphFusion;
 class ov::pass::LoraSubgraphFusion : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
-    LoraSubgraphFusion();
+    /**
+     * @param allow_adapter_selection also fuse the multi-adapter pattern, in which every LoRA state is a stack of
+     * adapters selected per batch row by Gather(state, adapter_indices, 0). The resulting LoraSubgraph gets
+     * adapter_indices as the 6th input, so it must be enabled only by plugins which support such LoraSubgraph.
+     */
+    explicit LoraSubgraphFusion(bool allow_adapter_selection = false);
 };
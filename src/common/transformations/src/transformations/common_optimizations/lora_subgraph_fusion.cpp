@@ -11,6 +11,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
@@ -23,11 +24,12 @@
 
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 
 namespace ov::pass {
 
-LoraSubgraphFusion::LoraSubgraphFusion() {
+LoraSubgraphFusion::LoraSubgraphFusion(bool allow_adapter_selection) {
     MATCHER_SCOPE(LoraSubgraphFusion);
     auto lora_input_m = pattern::any_input();
     auto transpose_const1_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
@@ -36,15 +38,24 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
 
     auto read_value1_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert1_m = pattern::optional<v0::Convert>(read_value1_m, pattern::consumers_count(1));
-    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, convert1_m}, pattern::consumers_count(1));
+    auto gather1_m = pattern::optional<v8::Gather>(
+        {convert1_m, pattern::any_input(), pattern::wrap_type<v0::Constant>()},
+        pattern::consumers_count(1));
+    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, gather1_m}, pattern::consumers_count(1));
 
     auto read_value2_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert2_m = pattern::optional<v0::Convert>(read_value2_m, pattern::consumers_count(1));
-    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, convert2_m}, pattern::consumers_count(1));
+    auto gather2_m = pattern::optional<v8::Gather>(
+        {convert2_m, pattern::any_input(), pattern::wrap_type<v0::Constant>()},
+        pattern::consumers_count(1));
+    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, gather2_m}, pattern::consumers_count(1));
 
     auto read_value3_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert3_m = pattern::optional<v0::Convert>(read_value3_m, pattern::consumers_count(1));
-    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, convert3_m}, pattern::consumers_count(1));
+    auto gather3_m = pattern::optional<v8::Gather>(
+        {convert3_m, pattern::any_input(), pattern::wrap_type<v0::Constant>()},
+        pattern::consumers_count(1));
+    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, gather3_m}, pattern::consumers_count(1));
 
     auto transpose_const2_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
     auto transpose2_m = pattern::optional<v1::Transpose>({matmul2_m, transpose_const2_m}, pattern::consumers_count(1));
@@ -71,6 +82,25 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        // Multi-adapter LoRA: all the states are selected by the same adapter indices along the leading axis
+        const size_t gathers_count = pattern_map.count(gather1_m) + pattern_map.count(gather2_m) +
+                                     pattern_map.count(gather3_m);
+        const bool with_adapter_selection = gathers_count == 3;
+        if (gathers_count != 0 && (!with_adapter_selection || !allow_adapter_selection)) {
+            return false;
+        }
+        std::vector<std::shared_ptr<v8::Gather>> gathers;
+        if (with_adapter_selection) {
+            for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+                auto gather = ov::as_type_ptr<v8::Gather>(pattern_map.at(gather_m).get_node_shared_ptr());
+                if (!gather || gather->get_axis() != 0 || gather->get_batch_dims() != 0 ||
+                    gather->input_value(1) != pattern_map.at(gather1_m).get_node()->input_value(1)) {
+                    return false;
+                }
+                gathers.push_back(gather);
+            }
+        }
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -86,11 +116,12 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
+            with_adapter_selection ? gathers[0]->input(0) : matmul1.get_node()->input(1),
+            with_adapter_selection ? gathers[1]->input(0)
+                                   : find_connected_input(multiply.get_node(), state_2.get_node()),
+            with_adapter_selection ? gathers[2]->input(0) : matmul2.get_node()->input(1),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
@@ -105,6 +136,16 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (with_adapter_selection) {
+            const auto adapter_indices = gathers[0]->input_value(1);
+            auto indices_parameter = std::make_shared<v0::Parameter>(adapter_indices.get_element_type(),
+                                                                     adapter_indices.get_partial_shape());
+            for (const auto& gather : gathers) {
+                gather->input(1).replace_source_output(indices_parameter);
+            }
+            subgraph_parameters.push_back(indices_parameter);
+            external_connections.push_back(adapter_indices);
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
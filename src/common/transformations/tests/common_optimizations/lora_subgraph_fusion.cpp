@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -24,6 +25,7 @@ using namespace ov;
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
 namespace v6 = ov::op::v6;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 static constexpr auto netType = ov::element::f32;
 
@@ -78,6 +80,15 @@ std::shared_ptr<ov::Node> create_lora_subgraph(const ov::Output<ov::Node>& main_
     return std::make_shared<v1::Add>(add_in_0, add_in_1);
 }
 
+ov::OutputVector select_adapters(const ov::OutputVector& states, const ov::Output<ov::Node>& adapter_indices) {
+    ov::OutputVector selected;
+    for (const auto& state : states) {
+        auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        selected.push_back(std::make_shared<v8::Gather>(state, adapter_indices, axis));
+    }
+    return selected;
+}
+
 class LoraSubgraphFusionTests : public TransformationTestsF {
 public:
     LoraSubgraphFusionTests() : TransformationTestsF() {
@@ -89,8 +100,11 @@ public:
 
     void SetUp() override {
         TransformationTestsF::SetUp();
-        manager.register_pass<ov::pass::LoraSubgraphFusion>();
+        manager.register_pass<ov::pass::LoraSubgraphFusion>(allow_adapter_selection);
     }
+
+protected:
+    bool allow_adapter_selection = false;
 };
 
 class LoraSubgraphFusionMatMulTests : public LoraSubgraphFusionTests {
@@ -229,6 +243,93 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+class LoraSubgraphFusionMultiAdapterTests : public LoraSubgraphFusionTests {
+public:
+    LoraSubgraphFusionMultiAdapterTests() : LoraSubgraphFusionTests() {
+        allow_adapter_selection = true;
+    }
+
+    const ov::Dimension K = 563;
+    const ov::Dimension N = 2048;
+    ov::PartialShape shape_x = {-1, -1, K};
+    ov::PartialShape shape_w = {N, K};
+    ov::PartialShape shape_indices = {-1};
+    ov::PartialShape shape_state_1 = {-1, -1, K};
+    ov::PartialShape shape_state_2 = {-1, 1, -1};
+    ov::PartialShape shape_state_3 = {-1, N, -1};
+};
+
+TEST_F(LoraSubgraphFusionMultiAdapterTests, AdapterSelection) {
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto states = create_states({shape_state_1, shape_state_2, shape_state_3});
+        auto selected_states = select_adapters(states.first, param_indices);
+        auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, selected_states, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        states.second,
+                                        ParameterVector{param_lora, param_w, param_indices});
+    }
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto inner_state_1 = std::make_shared<v0::Parameter>(netType, shape_state_1);
+        auto inner_state_2 = std::make_shared<v0::Parameter>(netType, shape_state_2);
+        auto inner_state_3 = std::make_shared<v0::Parameter>(netType, shape_state_3);
+        auto inner_param_mm = std::make_shared<v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_param_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+
+        auto selected_states = select_adapters({inner_state_1, inner_state_2, inner_state_3}, inner_param_indices);
+        auto lora_subgraph = create_lora_subgraph(inner_param_mm, inner_param_lora, selected_states, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_state_1,
+                                         inner_state_2,
+                                         inner_state_3,
+                                         inner_param_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto states = create_states({shape_state_1, shape_state_2, shape_state_3});
+        ov::OutputVector lora_inputs{main_mm,
+                                     param_lora,
+                                     states.first[0],
+                                     states.first[1],
+                                     states.first[2],
+                                     param_indices};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            states.second,
+                                            ParameterVector{param_lora, param_w, param_indices});
+    }
+}
+
+TEST_F(LoraSubgraphFusionMatMulTests, AdapterSelectionIsNotFusedByDefault) {
+    auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+    auto param_indices = std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+    main_mm->set_friendly_name("main_mm");
+    auto states = create_states({{-1, -1, K}, {-1, 1, -1}, {-1, N, -1}});
+    auto selected_states = select_adapters(states.first, param_indices);
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, selected_states, false);
+    lora_subgraph->set_friendly_name("lora_subgraph");
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    states.second,
+                                    ParameterVector{param_lora, param_w, param_indices});
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
@@ -33,21 +34,38 @@ public:
 
     virtual FilePosition write(const std::vector<std::string_view>& chunks, size_t& new_size);
 
+    /// \brief Computes hashes of the given blobs in parallel ahead of the write calls, so the sequential write only
+    /// looks them up for deduplication. A blob is matched by its data pointer and size, others are hashed on write.
+    void precompute_hashes(const std::vector<std::pair<const char*, size_t>>& blobs);
+
+    /// \brief Pads the output with zeros so every newly written blob starts at a multiple of the alignment, e.g. the
+    /// page size to let the reader map the weights directly. Values 0 and 1 disable the padding.
+    void set_alignment(size_t alignment);
+
     uint64_t get_data_hash() const {
         return m_data_hash;
     }
 
+    bool is_compression_enabled() const {
+        return m_enable_compression;
+    }
+
 private:
+    HashValue get_hash(const char* ptr, size_t size) const;
+    FilePosition aligned_write_offset();
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
     ConstWritePositions m_hash_to_file_positions;
+    std::unordered_map<const void*, std::pair<size_t, HashValue>> m_precomputed_hashes;
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
+    size_t m_alignment;
 };
 }  // namespace ov::util
@@ -46,6 +46,10 @@ public:
               const std::filesystem::path& bin_path,
               Version version = Version::UNSPECIFIED);
 
+    /// @brief Aligns the offset of every constant in the weights file to the given number of bytes, e.g. to the page
+    /// size to let the weights be mapped directly on load. The padding is disabled by default.
+    void set_weights_alignment(size_t alignment);
+
 private:
     std::ostream* m_xml_file;
     std::ostream* m_bin_file;
@@ -53,6 +57,7 @@ private:
     const std::filesystem::path m_bin_path;
     const Version m_version;
     const std::map<std::string, ov::OpSet> m_custom_opsets;
+    size_t m_weights_alignment = 0;
 };
 
 /**
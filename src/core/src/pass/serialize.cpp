@@ -17,6 +17,8 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -52,6 +54,21 @@ inline void convert_py_rt_info(std::shared_ptr<ov::Model> model) {
     ov::pass::ConvertLegacyPrecisionAttribute().run_on_model(model);
 }
 
+void collect_constant_data(const ov::Model& model, std::vector<std::pair<const char*, size_t>>& constant_data) {
+    for (const auto& node : model.get_ops()) {
+        if (const auto constant = ov::as_type<ov::op::v0::Constant>(node.get())) {
+            if (constant->get_element_type() != ov::element::string) {
+                constant_data.emplace_back(static_cast<const char*>(constant->get_data_ptr()),
+                                           constant->get_byte_size());
+            }
+        } else if (const auto multi_subgraph = ov::as_type<ov::op::util::MultiSubGraphOp>(node.get())) {
+            for (const auto& body : multi_subgraph->get_functions()) {
+                collect_constant_data(*body, constant_data);
+            }
+        }
+    }
+}
+
 void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
@@ -75,6 +92,13 @@ void serialize_func(std::ostream& xml_file,
         version != static_cast<int64_t>(ov::pass::Serialize::Version::IR_V11)) {
         OPENVINO_THROW("Unsupported version");
     }
+    if (constant_writer.is_compression_enabled()) {
+        // hash the weights in parallel, the serializer writes them sequentially afterwards
+        std::vector<std::pair<const char*, size_t>> constant_data;
+        collect_constant_data(*model, constant_data);
+        constant_writer.precompute_hashes(constant_data);
+    }
+
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
@@ -91,8 +115,10 @@ void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
-                    bool deterministic = false) {
+                    bool deterministic = false,
+                    size_t weights_alignment = 0) {
     ov::util::ConstantWriter constant_write_handler(bin_file);
+    constant_write_handler.set_alignment(weights_alignment);
     serialize_func(xml_file, bin_file, std::move(model), ver, deterministic, constant_write_handler);
 }
 
@@ -116,7 +142,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     convert_py_rt_info(model);
 
     if (m_xml_file && m_bin_file) {
-        serialize_func(*m_xml_file, *m_bin_file, model, m_version);
+        serialize_func(*m_xml_file, *m_bin_file, model, m_version, false, m_weights_alignment);
     } else {
         ov::util::create_directory_recursive(m_xml_path.parent_path());
 
@@ -130,7 +156,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            serialize_func(xml_file, bin_file, model, m_version, false, m_weights_alignment);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -165,6 +191,10 @@ pass::Serialize::Serialize(const std::filesystem::path& xml_path,
     validate_xml_path(m_xml_path);
 }
 
+void pass::Serialize::set_weights_alignment(size_t alignment) {
+    m_weights_alignment = alignment;
+}
+
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        const std::function<void(std::ostream&)>& custom_data_serializer,
                                        const std::function<std::string(const std::string&)>& cache_encrypt,
@@ -4,7 +4,10 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <algorithm>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/common_util.hpp"
@@ -16,7 +19,8 @@ ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
       m_binary_output(bin_data),
       m_enable_compression(enable_compression),
       m_blob_offset(bin_data.tellp()),
-      m_data_hash{} {}
+      m_data_hash{},
+      m_alignment{1} {}
 
 ConstantWriter::~ConstantWriter() = default;
 
@@ -26,19 +30,18 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    bool compress_to_fp16,
                                                    ov::element::Type src_type,
                                                    bool ptr_is_temporary) {
-    const FilePosition write_pos = m_binary_output.get().tellp();
-    const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
     const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
+    FilePosition offset = 0;
     if (m_enable_compression) {
         // This hash is weak (but efficient). For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash = compress_to_fp16 ? ov::runtime::compute_hash(data_ptr, new_size) : get_hash(ptr, size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
@@ -47,6 +50,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                 return it->second.first;
             }
         }
+        offset = aligned_write_offset();
         if (!ptr_is_temporary) {
             // Since fp16_compressed data will be disposed at exit point and since we cannot reread it from the
             // ostream, we store pointer to the original uncompressed blob.
@@ -56,6 +60,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
     } else {
         // fast hash (skip data)
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
+        offset = aligned_write_offset();
     }
     m_binary_output.get().write(data_ptr, new_size);
     return offset;
@@ -85,15 +90,13 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
         // Cache miss: store the packed buffer so its pointer stays valid for future memcmp
         m_packed_string_data.push_back(std::move(tmp));
         const char* stable_ptr = m_packed_string_data.back().data();
-        const FilePosition write_pos = m_binary_output.get().tellp();
-        const FilePosition offset = write_pos - m_blob_offset;
+        const FilePosition offset = aligned_write_offset();
         m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(stable_ptr)}});
         m_data_hash = util::u64_hash_combine(m_data_hash, hash);
         m_binary_output.get().write(stable_ptr, new_size);
         return offset;
     } else {
-        const FilePosition write_pos = m_binary_output.get().tellp();
-        const FilePosition offset = write_pos - m_blob_offset;
+        const FilePosition offset = aligned_write_offset();
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
         for (const auto& sv : chunks)
             m_binary_output.get().write(sv.data(), sv.size());
@@ -101,6 +104,54 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     }
 }
 
+void ConstantWriter::precompute_hashes(const std::vector<std::pair<const char*, size_t>>& blobs) {
+    if (!m_enable_compression) {
+        return;
+    }
+    // shared constants point to the same data, hash each blob once
+    std::vector<std::pair<const char*, size_t>> unique_blobs;
+    unique_blobs.reserve(blobs.size());
+    for (const auto& [ptr, size] : blobs) {
+        if (ptr != nullptr && m_precomputed_hashes.emplace(ptr, std::make_pair(size, HashValue{})).second) {
+            unique_blobs.emplace_back(ptr, size);
+        }
+    }
+
+    std::vector<HashValue> hashes(unique_blobs.size());
+    ov::parallel_for(unique_blobs.size(), [&](size_t i) {
+        hashes[i] = ov::runtime::compute_hash(unique_blobs[i].first, unique_blobs[i].second);
+    });
+    for (size_t i = 0; i < unique_blobs.size(); ++i) {
+        m_precomputed_hashes[unique_blobs[i].first].second = hashes[i];
+    }
+}
+
+void ConstantWriter::set_alignment(size_t alignment) {
+    m_alignment = std::max<size_t>(alignment, 1);
+}
+
+ConstantWriter::HashValue ConstantWriter::get_hash(const char* ptr, size_t size) const {
+    const auto precomputed = m_precomputed_hashes.find(ptr);
+    if (precomputed != m_precomputed_hashes.end() && precomputed->second.first == size) {
+        return precomputed->second.second;
+    }
+    return ov::runtime::compute_hash(ptr, size);
+}
+
+ConstantWriter::FilePosition ConstantWriter::aligned_write_offset() {
+    const FilePosition write_pos = m_binary_output.get().tellp();
+    const auto offset = write_pos - m_blob_offset;
+    if (m_alignment == 1) {
+        return offset;
+    }
+    const auto padding = (m_alignment - static_cast<size_t>(offset) % m_alignment) % m_alignment;
+    if (padding != 0) {
+        const std::vector<char> zeros(padding, 0);
+        m_binary_output.get().write(zeros.data(), static_cast<std::streamsize>(padding));
+    }
+    return offset + static_cast<FilePosition>(padding);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
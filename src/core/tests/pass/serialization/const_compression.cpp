@@ -444,3 +444,33 @@ TEST_F(SerializationConstantCompressionTest, IdenticalStringConstantsRoundTrip)
         }
     }
 }
+
+TEST_F(SerializationConstantCompressionTest, AlignedConstantsRoundTrip) {
+    constexpr size_t alignment = 64;
+    const ov::Shape shape{3};
+
+    auto A = ov::op::v0::Constant::create(ov::element::i32, shape, {1, 2, 3});
+    auto B = ov::op::v0::Constant::create(ov::element::i32, shape, {4, 5, 6});
+    auto C = ov::op::v0::Constant::create(ov::element::i32, shape, {1, 2, 3});
+
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize serialize(m_out_xml_path_1, m_out_bin_path_1);
+    serialize.set_weights_alignment(alignment);
+    serialize.run_on_model(model);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    // the second unique constant starts at the aligned offset, the identical one is still deduplicated
+    ASSERT_EQ(file_size(bin_1), alignment + ov::shape_size(shape) * sizeof(int32_t));
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+    const auto& results = model_imported->get_results();
+    ASSERT_EQ(results.size(), 3u);
+    const std::vector<std::vector<int32_t>> expected{{1, 2, 3}, {4, 5, 6}, {1, 2, 3}};
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto c = ov::as_type_ptr<ov::op::v0::Constant>(results[i]->get_input_node_shared_ptr(0));
+        ASSERT_NE(c, nullptr);
+        EXPECT_EQ(c->get_vector<int32_t>(), expected[i]);
+    }
+}
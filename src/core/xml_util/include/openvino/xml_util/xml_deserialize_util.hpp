@@ -72,6 +72,13 @@ public:
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override;
 
+    /// \brief Enables releasing XML of every layer of the main graph right after its operation is created.
+    /// Only the nodes and attributes are freed, pugixml keeps the text of the document in its own buffer.
+    /// The document can't be deserialized again then.
+    void set_release_parsed_layers(bool release) {
+        m_release_parsed_layers = release;
+    }
+
 protected:
     virtual ov::Any parse_weightless_cache_attribute(const pugi::xml_node& node) const;
     virtual void set_constant_num_buffer(ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>& adapter);
@@ -107,9 +114,11 @@ private:
     /// \brief Traverses xml node representation in order to create ov function for it.
     /// \param node xml node representation
     /// \param weights weights attached to current node
+    /// \param main_graph true for the main graph, false for bodies of subgraph operations
     /// \return shared pointer to function representing input node
     std::shared_ptr<ov::Model> parse_function(const pugi::xml_node& root,
-                                              const std::shared_ptr<ov::AlignedBuffer>& weights);
+                                              const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                              bool main_graph = false);
     /// \brief Traverses xml node representation in order to get the purpose attribute of
     /// inputs/outputs in the body of Loop op. \param node xml node representation \return struct
     /// with value of purpuse attribute
@@ -152,6 +161,7 @@ private:
     IoMap io_map;
 
     int64_t m_version;
+    bool m_release_parsed_layers = false;
 };
 
 }  // namespace ov::util
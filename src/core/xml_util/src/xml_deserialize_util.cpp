@@ -4,6 +4,7 @@
 
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 
+#include <future>
 #include <regex>
 #include <stack>
 #include <string_view>
@@ -870,7 +871,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<std:
         }
         model = parse_function(m_node.child(name.c_str()), m_weights);
     } else if (!name.compare("net")) {
-        model = parse_function(m_node, m_weights);
+        model = parse_function(m_node, m_weights, true);
     } else {
         OPENVINO_THROW("Error: not recognized adapter name: ", name, ".");
     }
@@ -919,7 +920,8 @@ void XmlDeserializer::set_constant_num_buffer(ov::AttributeAdapter<std::shared_p
 }
 
 std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node& root,
-                                                           const std::shared_ptr<ov::AlignedBuffer>& weights) {
+                                                           const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                                           bool main_graph) {
     // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
     struct FunctionNodes {
@@ -943,9 +945,28 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
 
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    using EdgesMap = std::map<size_t /*to-layer-id*/, std::vector<Edge>>;
+    // Read all edges and store them for further usage
+    const auto read_edges = [root]() {
+        EdgesMap edges;
+        FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+            size_t fromLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-layer"));
+            size_t fromPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-port"));
+            size_t toLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-layer"));
+            size_t toPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-port"));
+            edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        }
+        return edges;
+    };
+    // The edges don't depend on the layers, so for the main graph they are read concurrently with the layers
+    std::future<EdgesMap> edges_reading;
+    if (main_graph) {
+        edges_reading = std::async(std::launch::async, read_edges);
+    }
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
+    auto layers = root.child("layers");
+    FOREACH_CHILD (node, layers, "layer") {
         auto node_param = parse_generic_params(node);
         params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
@@ -956,17 +977,16 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
             // To do so, handle nodes manually and ignore during DFS
             dfs_used_nodes.insert(node_param.layerId);
             order.push_back(node_param.layerId);
-            edges[node_param.layerId] = {};
         }
     }
 
-    // Read all edges and store them for further usage
-    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
-        size_t fromLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-layer"));
-        size_t fromPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-port"));
-        size_t toLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-layer"));
-        size_t toPort = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "to-port"));
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+    auto edges = edges_reading.valid() ? edges_reading.get() : read_edges();
+    for (const auto& parameter_id : order) {
+        edges.try_emplace(parameter_id);
+    }
+    const bool release_parsed_layers = main_graph && m_release_parsed_layers;
+    if (release_parsed_layers) {
+        pugi::xml_node(root).remove_child("edges");
     }
 
     // Run DFS starting from outputs to get nodes topological order
@@ -1058,6 +1078,12 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         }
 
         func_nodes.all.emplace_back(node);
+
+        if (release_parsed_layers) {
+            // The layer XML isn't needed anymore, so its nodes don't stay in memory along with the created model
+            layers.remove_child(p.xml);
+            p.xml = {};
+        }
     }
 
     auto function = std::make_shared<ov::Model>(func_nodes.results,
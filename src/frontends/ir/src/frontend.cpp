@@ -154,6 +154,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ov::AlignedBuffer> model_buf;
     std::shared_ptr<ov::AlignedBuffer> weights;
+    std::filesystem::path model_path;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -174,7 +175,8 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             auto input_model = std::make_shared<InputModel>(local_model_stream,
                                                             weights,
                                                             create_extensions_map(),
-                                                            std::move(weights_path));
+                                                            std::move(weights_path),
+                                                            model_path);
             local_model_stream.close();
             return input_model;
         } else if (model_buf) {
@@ -183,7 +185,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         return nullptr;
     };
 
-    std::filesystem::path weights_path, model_path;
+    std::filesystem::path weights_path;
 
     if (const auto& model_variant = variants[0]; model_variant.is<std::istream*>()) {
         provided_model_stream = model_variant.as<std::istream*>();
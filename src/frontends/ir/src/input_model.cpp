@@ -4,6 +4,7 @@
 
 #include "input_model.hpp"
 
+#include <fstream>
 #include <pugixml.hpp>
 
 #include "openvino/core/except.hpp"
@@ -209,17 +210,22 @@ class InputModel::InputModelIRImpl {
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
     std::filesystem::path m_weights_path;
+    // The sources the document can be parsed again from, the provided stream can't be read again
+    std::filesystem::path m_model_path;
+    std::shared_ptr<ov::AlignedBuffer> m_model_buf;
+    bool m_layers_released = false;
 
 public:
     InputModelIRImpl(std::istream& model,
                      const std::shared_ptr<ov::AlignedBuffer>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                     std::filesystem::path weights_path)
+                     std::filesystem::path weights_path,
+                     std::filesystem::path model_path)
         : m_weights(weights),
           m_extensions(extensions),
-          m_weights_path(std::move(weights_path)) {
-        pugi::xml_parse_result res = m_xml_doc.load(model);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+          m_weights_path(std::move(weights_path)),
+          m_model_path(std::move(model_path)) {
+        load_document(model);
         init_opset();
     }
 
@@ -229,17 +235,37 @@ public:
                      std::filesystem::path weights_path)
         : m_weights(weights),
           m_extensions(extensions),
-          m_weights_path(std::move(weights_path)) {
-        auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+          m_weights_path(std::move(weights_path)),
+          m_model_buf(model) {
+        load_document();
         init_opset();
     }
 
     std::shared_ptr<ov::Model> convert();
 
 private:
-    void init_opset() {
+    void load_document(std::istream& model) {
+        pugi::xml_parse_result res = m_xml_doc.load(model);
+        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
         m_root = m_xml_doc.document_element();
+    }
+
+    void load_document() {
+        if (m_model_buf) {
+            auto res = m_xml_doc.load_buffer(m_model_buf->get_ptr(),
+                                             m_model_buf->size(),
+                                             pugi::parse_default,
+                                             pugi::encoding_utf8);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+            m_root = m_xml_doc.document_element();
+        } else {
+            std::ifstream model(m_model_path, std::ios::in | std::ifstream::binary);
+            OPENVINO_ASSERT(model.is_open(), "Model file ", m_model_path, " cannot be opened!");
+            load_document(model);
+        }
+    }
+
+    void init_opset() {
         for (const auto& it : ov::get_available_opsets()) {
             m_opsets[it.first] = it.second();
         }
@@ -249,8 +275,13 @@ private:
 InputModel::InputModel(std::istream& model,
                        const std::shared_ptr<ov::AlignedBuffer>& weights,
                        const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-                       std::filesystem::path weights_path) {
-    _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions, std::move(weights_path));
+                       std::filesystem::path weights_path,
+                       std::filesystem::path model_path) {
+    _impl = std::make_shared<InputModelIRImpl>(model,
+                                               weights,
+                                               extensions,
+                                               std::move(weights_path),
+                                               std::move(model_path));
 }
 
 InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
@@ -267,9 +298,19 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
+    if (m_layers_released) {
+        load_document();
+    }
+
     // Load default opsets
     size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
     ov::util::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    // Layers are released from the DOM while the model is being built to lower the peak memory, then the document
+    // is parsed again if the model is converted once more. pugixml keeps the text of the document in its own buffer,
+    // so only the nodes and attributes of the layers are freed.
+    const bool release_layers = m_model_buf || !m_model_path.empty();
+    visitor.set_release_parsed_layers(release_layers);
+    m_layers_released = release_layers;
     std::shared_ptr<ov::Model> model;
     visitor.on_attribute("net", model);
     model->get_rt_info()["version"] = int64_t(version);
@@ -22,10 +22,13 @@ class InputModel : public ov::frontend::InputModel {
     std::shared_ptr<InputModelIRImpl> _impl;
 
 public:
+    /// \param model_path path of the file the stream is read from, if it is set the XML document is released during
+    /// the conversion and parsed from the file again for another conversion
     InputModel(std::istream& stream,
                const std::shared_ptr<ov::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
-               std::filesystem::path weights_path = {});
+               std::filesystem::path weights_path = {},
+               std::filesystem::path model_path = {});
 
     InputModel(const std::shared_ptr<ov::AlignedBuffer>& model_buf,
                const std::shared_ptr<ov::AlignedBuffer>& weights,
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+
 #include "common_test_utils/test_assertions.hpp"
 #include "frontend_test.hpp"
 #include "openvino/core/graph_util.hpp"
@@ -13,6 +16,7 @@
 #include "openvino/opsets/opset1_decl.hpp"
 #include "openvino/opsets/opset3_decl.hpp"
 #include "openvino/opsets/opset6_decl.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "utils.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
@@ -1833,3 +1837,118 @@ TEST_F(IRFrontendTests, VeryShortValidModel) {
     OV_ASSERT_NO_THROW(version = model->get_rt_info().at("version").as<int64_t>());
     ASSERT_EQ(11, version);
 }
+
+TEST_F(IRFrontendTests, input_model_converted_twice) {
+    // The XML of the layers is released during the conversion, so the document is parsed again for another one
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="0" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="Transpose0321" type="Transpose" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<unsigned char> buffer(32, 0);
+    uint64_t* uint64Buffer = reinterpret_cast<uint64_t*>(buffer.data());
+    uint64Buffer[0] = 0;
+    uint64Buffer[1] = 3;
+    uint64Buffer[2] = 2;
+    uint64Buffer[3] = 1;
+
+    createTemporalModelFile(xmlModel, buffer);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 3, 22, 22});
+        parameter->set_friendly_name("input");
+        auto constant =
+            std::make_shared<ov::opset1::Constant>(ov::element::i64, ov::Shape{4}, std::vector<uint64_t>{0, 3, 2, 1});
+        constant->set_friendly_name("value1");
+        auto transpose = std::make_shared<ov::opset1::Transpose>(parameter, constant);
+        transpose->set_friendly_name("Transpose0321");
+        auto result = std::make_shared<ov::opset1::Result>(transpose);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{parameter});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+
+    auto model_buffer = std::make_shared<ov::AlignedBuffer>(xmlModel.size());
+    std::memcpy(model_buffer->get_ptr(), xmlModel.data(), xmlModel.size());
+    std::istringstream model_stream(xmlModel);
+
+    auto fe = manager.load_by_framework("ir");
+    for (const auto& model_variant : {ov::Any(xmlFileName), ov::Any(model_buffer), ov::Any(&model_stream)}) {
+        ov::frontend::InputModel::Ptr input_model;
+        OV_ASSERT_NO_THROW(input_model = fe->load({model_variant, binFileName}));
+        ASSERT_TRUE(!!input_model);
+
+        std::shared_ptr<ov::Model> model, model_again;
+        OV_ASSERT_NO_THROW(model = fe->convert(input_model));
+        OV_ASSERT_NO_THROW(model_again = fe->convert(input_model));
+
+        for (const auto& converted : {model, model_again}) {
+            const auto res = fc.compare(converted, modelRef);
+            EXPECT_TRUE(res.valid) << res.message;
+        }
+    }
+}
@@ -6,8 +6,10 @@
 
 #include <exception>
 #include <functional>
+#include <map>
 #include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "core/node.hpp"
 #include "core/null_node.hpp"
@@ -17,6 +19,8 @@
 #include "onnx_framework_node.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/rt_info.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
@@ -88,6 +92,36 @@ ov::frontend::ExtensionHolder subgraph_required_extensions(
     extensions.conversions = parent_graph_extensions.conversions;
     return extensions;
 }
+
+void convert_subgraphs(const std::unordered_map<std::string, std::shared_ptr<Subgraph>>& subgraphs) {
+    if (subgraphs.size() < 2) {
+        for (const auto& kv : subgraphs) {
+            kv.second->convert();
+        }
+        return;
+    }
+    // Sibling subgraphs (e.g. If branches) don't depend on each other, so they are converted in parallel.
+    // The attribute names order keeps the reported error deterministic.
+    std::map<std::string, std::shared_ptr<Subgraph>> ordered_subgraphs{subgraphs.begin(), subgraphs.end()};
+    std::vector<std::shared_ptr<Subgraph>> to_convert;
+    for (const auto& kv : ordered_subgraphs) {
+        kv.second->set_concurrent_conversion(true);
+        to_convert.push_back(kv.second);
+    }
+    std::vector<std::exception_ptr> errors(to_convert.size());
+    ov::parallel_for(to_convert.size(), [&](size_t i) {
+        try {
+            to_convert[i]->convert();
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
 }  // namespace detail
 
 Graph::Graph(const std::filesystem::path& model_dir,
@@ -112,10 +146,27 @@ Graph::Graph(const std::filesystem::path& model_dir,
 
     std::map<std::string, Tensor> initializers;
 
+    // Without mmap the small external data of all initializers is read at once instead of one by one
+    detail::ExternalDataPreloaderPtr preloaded_data;
+    if (!m_mmap_cache) {
+        for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
+            if (initializer_tensor.has_data_location() &&
+                initializer_tensor.data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+                if (!preloaded_data) {
+                    preloaded_data = std::make_shared<detail::ExternalDataPreloader>(m_model_dir);
+                }
+                preloaded_data->add(detail::TensorExternalData(initializer_tensor));
+            }
+        }
+        if (preloaded_data) {
+            preloaded_data->load();
+        }
+    }
+
     // Process all initializers in the graph
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
+            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache, preloaded_data};
             std::shared_ptr<ov::op::v0::Constant> ov_constant;
             // For each initializer create a Constant node and store it in cache
             try {
@@ -165,11 +216,7 @@ void Graph::convert_to_ov_nodes() {
             m_model->enable_opset_domain(node.domain(), m_ops_bridge);
         }
         if (node.has_subgraphs()) {
-            const auto& subgraphs = node.get_subgraphs();
-            for (auto& kv : subgraphs) {
-                auto& subgraph = kv.second;
-                subgraph->convert();
-            }
+            detail::convert_subgraphs(node.get_subgraphs());
         }
         ov::OutputVector ov_nodes{make_ov_nodes(node)};
         ++completed;
@@ -450,12 +497,23 @@ bool Subgraph::is_ov_node_in_cache(const std::string& name) const {
 }
 
 Output<ov::Node> Subgraph::get_ov_node_from_cache(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_parent_scope_mutex);
     if (m_cache->contains(name)) {
         return m_cache->get_node(name);
     }
     const auto from_parent_node = m_parent_graph->get_ov_node_from_cache(name);
-    if (ov::op::util::is_constant(from_parent_node.get_node()))
-        return from_parent_node;
+    if (ov::op::util::is_constant(from_parent_node.get_node())) {
+        if (!m_concurrent_conversion) {
+            return from_parent_node;
+        }
+        const auto& parent_constant = from_parent_node.get_node_shared_ptr();
+        const auto constant = parent_constant->clone_with_new_inputs({});
+        constant->set_friendly_name(parent_constant->get_friendly_name());
+        ov::copy_runtime_info(parent_constant, constant);
+        constant->output(0).set_names(from_parent_node.get_names());
+        m_cache->emplace_node(name, constant->output(0));
+        return constant->output(0);
+    }
     auto new_param = std::make_shared<ov::op::v0::Parameter>(from_parent_node.get_element_type(),
                                                              from_parent_node.get_partial_shape());
     // Set the original tensor name on the parameter output so that partition_body_parameters
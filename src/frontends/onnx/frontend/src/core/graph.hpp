@@ -8,6 +8,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -118,17 +119,26 @@ public:
     Subgraph() = delete;
 
     Subgraph(const Subgraph&) = delete;
-    Subgraph(Subgraph&&) = default;
+    Subgraph(Subgraph&&) = delete;
 
     Subgraph& operator=(const Subgraph&) = delete;
-    Subgraph& operator=(Subgraph&&) = default;
+    Subgraph& operator=(Subgraph&&) = delete;
 
     bool is_ov_node_in_cache(const std::string& name) const override;
     ov::Output<ov::Node> get_ov_node_from_cache(const std::string& name) override;
     void infer_inputs_from_parent();
 
+    /// \brief      Marks the subgraph as converted concurrently with its siblings. Constants of the parent graph
+    ///             are copied (sharing the data) then, since connecting to a shared node is not thread-safe.
+    void set_concurrent_conversion(bool concurrent) {
+        m_concurrent_conversion = concurrent;
+    }
+
 private:
     Graph* m_parent_graph;
+    bool m_concurrent_conversion = false;
+    // Guards the nodes registration from the parent scope which can be requested by concurrent child subgraphs
+    std::mutex m_parent_scope_mutex;
     std::vector<std::string> m_inputs_from_parent;
     std::unordered_map<std::shared_ptr<ov::op::v0::Parameter>, std::string> m_parameter_to_parent_node_map;
 };
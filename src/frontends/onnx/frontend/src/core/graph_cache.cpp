@@ -10,10 +10,12 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 void GraphCache::emplace_node(const std::string& name, ov::Output<ov::Node>&& node) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_graph_cache_map[name] = std::move(node);
 }
 
 void GraphCache::remove_node(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_graph_cache_map.find(name);
     if (it != m_graph_cache_map.end()) {
         m_graph_cache_map.erase(it);
@@ -21,6 +23,7 @@ void GraphCache::remove_node(const std::string& name) {
 }
 
 ov::Output<ov::Node> GraphCache::get_node(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
     try {
         return m_graph_cache_map.at(name);
     } catch (const std::out_of_range&) {
@@ -29,6 +32,7 @@ ov::Output<ov::Node> GraphCache::get_node(const std::string& name) const {
 }
 
 bool GraphCache::contains(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return (m_graph_cache_map.count(name) > 0);
 }
 }  // namespace onnx
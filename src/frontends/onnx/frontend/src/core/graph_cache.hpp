@@ -6,6 +6,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "openvino/core/node.hpp"
@@ -14,6 +15,8 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 /// \brief      GraphCache stores and provides access to ONNX graph initializers.
+///
+/// \note       Access to the cache is thread-safe, since subgraphs can be converted in parallel.
 class GraphCache {
 public:
     /// \brief      Add node to the cache or override the existing one.
@@ -49,6 +52,7 @@ public:
 
 private:
     std::map<std::string, ov::Output<ov::Node>> m_graph_cache_map;
+    mutable std::mutex m_mutex;
 };
 }  // namespace onnx
 }  // namespace frontend
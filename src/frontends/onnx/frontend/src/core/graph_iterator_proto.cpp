@@ -314,15 +314,7 @@ bool extract_tensor_external_data(ov::frontend::onnx::TensorMetaInfo& tensor_met
                                             : static_cast<size_t>(file_size) - static_cast<size_t>(ext_data_offset);
     auto memory_mode = graph_iterator->get_memory_management_mode();
     if (memory_mode == External_MMAP) {
-        auto cache = graph_iterator->get_mmap_cache();
-        auto cached_mapped_memory = cache->find(full_path);
-        std::shared_ptr<ov::MappedMemory> mapped_memory;
-        if (cached_mapped_memory != cache->end()) {
-            mapped_memory = cached_mapped_memory->second;
-        } else {
-            mapped_memory = ov::load_mmap_object(full_path);
-            (*cache)[full_path] = mapped_memory;
-        }
+        const auto mapped_memory = detail::get_mapped_memory(graph_iterator->get_mmap_cache(), full_path);
         tensor_meta_info.m_is_raw = true;
         tensor_meta_info.m_tensor_data =
             static_cast<uint8_t*>(static_cast<void*>(mapped_memory->data() + ext_data_offset));
@@ -428,6 +428,21 @@ std::vector<std::string> Tensor::get_data() const {
     ONNX_INVALID_DATA_TYPE(m_tensor_proto->data_type(), "STRING");
 }
 
+std::shared_ptr<ov::AlignedBuffer> Tensor::load_external_data(const detail::TensorExternalData& ext_data) const {
+    if (ext_data.data_location() == detail::ORT_MEM_ADDR) {
+        return ext_data.load_external_mem_data();
+    }
+    if (m_mmap_cache) {
+        return ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+    }
+    if (m_preloaded_data) {
+        if (auto buffer = m_preloaded_data->get(ext_data)) {
+            return buffer;
+        }
+    }
+    return ext_data.load_external_data(m_model_dir);
+}
+
 std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
     std::shared_ptr<ov::op::v0::Constant> constant{nullptr};
     if (m_tensor_proto != nullptr && m_tensor_proto->has_segment()) {
@@ -452,13 +467,7 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
                                                                m_tensor_place->get_data_size())
                                   : detail::TensorExternalData(*m_tensor_proto);
 
-        if (ext_data.data_location() == detail::ORT_MEM_ADDR) {
-            constant_buffer = ext_data.load_external_mem_data();
-        } else if (m_mmap_cache) {
-            constant_buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
-        } else {
-            constant_buffer = ext_data.load_external_data(m_model_dir);
-        }
+        constant_buffer = load_external_data(ext_data);
         if (element_count == 0 && constant_buffer) {
             element_count = constant_buffer->size() * 8 / ov_type.bitwidth();
         }
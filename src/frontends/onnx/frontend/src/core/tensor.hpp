@@ -188,12 +188,16 @@ public:
     };
 
     Tensor() = delete;
-    Tensor(const TensorProto& tensor, const std::filesystem::path& model_dir, detail::MappedMemoryHandles mmap_cache)
+    Tensor(const TensorProto& tensor,
+           const std::filesystem::path& model_dir,
+           detail::MappedMemoryHandles mmap_cache,
+           detail::ExternalDataPreloaderPtr preloaded_data = nullptr)
         : m_tensor_proto{&tensor},
           m_tensor_place(nullptr),
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_mmap_cache{mmap_cache} {
+          m_mmap_cache{mmap_cache},
+          m_preloaded_data{std::move(preloaded_data)} {
         if (m_shape == ov::Shape{0} && get_data_size() == 1) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a ov::Shape{0} stored in m_shape.
@@ -313,6 +317,8 @@ private:
                m_tensor_proto->data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
+    std::shared_ptr<ov::AlignedBuffer> load_external_data(const detail::TensorExternalData& ext_data) const;
+
     template <typename T>
     std::vector<T> get_external_data() const {
         const auto ext_data = m_tensor_place != nullptr
@@ -320,14 +326,7 @@ private:
                                                                reinterpret_cast<size_t>(m_tensor_place->get_data()),
                                                                m_tensor_place->get_data_size())
                                   : detail::TensorExternalData(*m_tensor_proto);
-        std::shared_ptr<ov::AlignedBuffer> buffer = nullptr;
-        if (ext_data.data_location() == detail::ORT_MEM_ADDR) {
-            buffer = ext_data.load_external_mem_data();
-        } else if (m_mmap_cache) {
-            buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
-        } else {
-            buffer = ext_data.load_external_data(m_model_dir);
-        }
+        const auto buffer = load_external_data(ext_data);
         return std::vector<T>(buffer->get_ptr<T>(), buffer->get_ptr<T>() + (buffer->size() / sizeof(T)));
     }
 
@@ -426,6 +425,7 @@ private:
     ov::Shape m_shape;
     std::filesystem::path m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    detail::ExternalDataPreloaderPtr m_preloaded_data;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -4,18 +4,35 @@
 
 #include "utils/tensor_external_data.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
 #include "exceptions.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/lazy_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/log.hpp"
+#include "openvino/util/parallel_io.hpp"
 
 namespace ov {
 namespace frontend {
 namespace onnx {
 namespace detail {
+namespace {
+#ifndef _WIN32
+using ov::util::INVALID_HANDLE_VALUE;
+#endif
+constexpr size_t lazy_loading_threshold = 0x100000;  // 1MB
+// Ranges separated by a smaller gap are read at once, the gap bytes are read in vain
+constexpr uint64_t coalescing_gap = 0x1000;  // 4KB
+// Coalesced ranges are not grown further to keep enough of them for parallel reading
+constexpr uint64_t coalescing_limit = 0x400000;  // 4MB
+}  // namespace
+
 TensorExternalData::TensorExternalData(const TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -40,6 +57,18 @@ TensorExternalData::TensorExternalData(const std::string& location, size_t offse
     m_data_length = size;
 }
 
+std::shared_ptr<ov::MappedMemory> get_mapped_memory(const MappedMemoryHandles& cache,
+                                                    const std::filesystem::path& full_path) {
+    // The caches are rarely accessed, only once per tensor, so one mutex is enough for all of them
+    static std::mutex cache_mutex;
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto& mapped_memory = (*cache)[full_path];
+    if (!mapped_memory) {
+        mapped_memory = ov::load_mmap_object(full_path);
+    }
+    return mapped_memory;
+}
+
 Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::filesystem::path& model_dir,
                                                                      MappedMemoryHandles cache) const {
     std::filesystem::path full_path;
@@ -54,14 +83,7 @@ Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::
         m_offset > static_cast<uint64_t>(file_size) - m_data_length) {
         throw error::invalid_external_data{*this};
     }
-    auto cached_mapped_memory = cache->find(full_path);
-    std::shared_ptr<ov::MappedMemory> mapped_memory;
-    if (cached_mapped_memory != cache->end()) {
-        mapped_memory = cached_mapped_memory->second;
-    } else {
-        mapped_memory = ov::load_mmap_object(full_path);
-        (*cache)[full_path] = mapped_memory;
-    }
+    const auto mapped_memory = get_mapped_memory(cache, full_path);
     if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
         throw error::invalid_external_data{*this};
     }
@@ -109,7 +131,6 @@ Buffer<ov::AlignedBuffer> TensorExternalData::load_external_data(const std::file
             lazy);
     };
 
-    constexpr size_t lazy_loading_threshold = 0x100000;  // 1MB
     return read_data_length >= lazy_loading_threshold ? get_lazy_buffer() : get_now_buffer();
 }
 
@@ -133,6 +154,114 @@ Buffer<ov::AlignedBuffer> TensorExternalData::load_external_mem_data() const {
                                                                                   aligned_memory);
 }
 
+ExternalDataPreloader::ExternalDataPreloader(std::filesystem::path model_dir) : m_model_dir(std::move(model_dir)) {}
+
+void ExternalDataPreloader::add(const TensorExternalData& external_data) {
+    if (external_data.data_location() == ORT_MEM_ADDR || external_data.size() == 0 ||
+        external_data.size() >= lazy_loading_threshold) {
+        return;
+    }
+    std::filesystem::path full_path;
+    try {
+        full_path = ov::util::sanitize_path(m_model_dir, ov::util::make_path(external_data.data_location()));
+    } catch (const std::runtime_error&) {
+        return;
+    }
+    const auto file_size = util::file_size(full_path);
+    if (file_size < 0 || external_data.size() > static_cast<uint64_t>(file_size) ||
+        external_data.offset() > static_cast<uint64_t>(file_size) - external_data.size()) {
+        return;
+    }
+    m_ranges[full_path].push_back({external_data.offset(), external_data.size(), nullptr});
+}
+
+void ExternalDataPreloader::load() {
+    struct ReadTask {
+        const std::filesystem::path* path;
+        Range* range;
+    };
+    std::vector<ReadTask> tasks;
+    for (auto& file_ranges : m_ranges) {
+        auto& ranges = file_ranges.second;
+        std::sort(ranges.begin(), ranges.end(), [](const Range& lhs, const Range& rhs) {
+            return lhs.offset < rhs.offset;
+        });
+        std::vector<Range> coalesced;
+        for (const auto& range : ranges) {
+            if (!coalesced.empty()) {
+                auto& last = coalesced.back();
+                const auto last_end = last.offset + last.size;
+                const auto range_end = range.offset + range.size;
+                if (range.offset <= last_end + coalescing_gap && last.size < coalescing_limit) {
+                    last.size = std::max(last_end, range_end) - last.offset;
+                    continue;
+                }
+            }
+            coalesced.push_back(range);
+        }
+        ranges = std::move(coalesced);
+        for (auto& range : ranges) {
+            range.data = std::make_shared<ov::AlignedBuffer>(range.size);
+            tasks.push_back({&file_ranges.first, &range});
+        }
+    }
+
+    std::atomic<bool> success{true};
+    ov::parallel_for(tasks.size(), [&](size_t i) {
+        const auto& task = tasks[i];
+        // Each task opens its own handle, so the OS readahead state is independent per thread
+        const auto handle = util::open_file_for_read(*task.path);
+        if (handle == INVALID_HANDLE_VALUE) {
+            success = false;
+            return;
+        }
+        if (!util::positional_read(handle,
+                                   task.range->data->get_ptr<char>(),
+                                   task.range->size,
+                                   static_cast<size_t>(task.range->offset))) {
+            success = false;
+        }
+        util::close_file_handle(handle);
+    });
+    if (!success) {
+        // Nothing is preloaded, so the tensors fall back to loading (and reporting errors) one by one
+        m_ranges.clear();
+    }
+}
+
+Buffer<ov::AlignedBuffer> ExternalDataPreloader::get(const TensorExternalData& external_data) const {
+    if (m_ranges.empty() || external_data.data_location() == ORT_MEM_ADDR || external_data.size() == 0) {
+        return nullptr;
+    }
+    std::filesystem::path full_path;
+    try {
+        full_path = ov::util::sanitize_path(m_model_dir, ov::util::make_path(external_data.data_location()));
+    } catch (const std::runtime_error&) {
+        return nullptr;
+    }
+    const auto file_ranges = m_ranges.find(full_path);
+    if (file_ranges == m_ranges.end()) {
+        return nullptr;
+    }
+    const auto& ranges = file_ranges->second;
+    const auto offset = external_data.offset();
+    // The last range which starts not after the requested offset
+    auto range = std::upper_bound(ranges.begin(), ranges.end(), offset, [](uint64_t value, const Range& r) {
+        return value < r.offset;
+    });
+    if (range == ranges.begin()) {
+        return nullptr;
+    }
+    --range;
+    if (!range->data || offset + external_data.size() > range->offset + range->size) {
+        return nullptr;
+    }
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+        range->data->get_ptr<char>() + (offset - range->offset),
+        external_data.size(),
+        range->data);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -7,6 +7,8 @@
 #include <onnx/onnx_pb.h>
 
 #include <filesystem>
+#include <map>
+#include <vector>
 
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -21,6 +23,13 @@ template <class T>
 using Buffer = std::shared_ptr<ov::SharedBuffer<std::shared_ptr<T>>>;
 using MappedMemoryHandles = std::shared_ptr<std::map<std::filesystem::path, std::shared_ptr<ov::MappedMemory>>>;
 using LocalStreamHandles = std::shared_ptr<std::map<std::filesystem::path, std::shared_ptr<std::ifstream>>>;
+
+/// \brief      Returns the mapping of the file from the cache, the file is mapped and cached on the first request
+///
+/// \note       Thread-safe, the subgraphs sharing the cache may be converted concurrently
+std::shared_ptr<ov::MappedMemory> get_mapped_memory(const MappedMemoryHandles& cache,
+                                                    const std::filesystem::path& full_path);
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -75,6 +84,11 @@ public:
         return m_data_location;
     }
 
+    /// \brief      Returns a stored data offset in the external file
+    uint64_t offset() const {
+        return m_offset;
+    }
+
 private:
     std::string m_data_location{};
     uint64_t m_offset = 0;
@@ -82,6 +96,40 @@ private:
     std::string m_sha1_digest{};
 };
 
+/// \brief  Helper class used to load external data of many tensors at once
+///
+/// \note   Only the tensors below the lazy loading threshold are handled, bigger ones are loaded lazily anyway.
+///         The ranges of the same file are sorted and adjacent ones are coalesced, then the ranges are read
+///         in parallel, each thread with its own file handle. The loaded tensors are views on these ranges.
+class ExternalDataPreloader {
+public:
+    explicit ExternalDataPreloader(std::filesystem::path model_dir);
+
+    /// \brief      Registers external data to be loaded, invalid references are skipped and left for
+    ///             TensorExternalData::load_external_data to report
+    void add(const TensorExternalData& external_data);
+
+    /// \brief      Reads all registered external data
+    ///
+    /// \note       If reading data from external files fails, nothing is preloaded.
+    void load();
+
+    /// \brief      Returns the loaded external data or nullptr if it wasn't registered
+    Buffer<ov::AlignedBuffer> get(const TensorExternalData& external_data) const;
+
+private:
+    struct Range {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        std::shared_ptr<ov::AlignedBuffer> data;
+    };
+
+    std::filesystem::path m_model_dir;
+    // external file path -> ranges to be read, sorted by offsets and coalesced after load()
+    std::map<std::filesystem::path, std::vector<Range>> m_ranges;
+};
+using ExternalDataPreloaderPtr = std::shared_ptr<ExternalDataPreloader>;
+
 /*
 As
 https://github.com/microsoft/onnxruntime/blob/4f6ae14e09729b3e3aba921de2e5bcc26d3e7768/onnxruntime/core/framework/tensorprotoutils.h#L206
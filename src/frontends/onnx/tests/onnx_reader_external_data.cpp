@@ -431,4 +431,44 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_from_ORT_MEM_ADDR) {
     test_case.run();
 }
 
+TEST_P(OnnxFeMmapFixture, onnx_external_data_in_if_branches) {
+    const auto path = test::utils::getModelFromTestModelZoo(string(TEST_ONNX_MODELS_DIRNAME) +
+                                                            "external_data/external_data_in_if_branches.onnx");
+    Core core;
+    core.set_property(enable_mmap(GetParam()));
+    // the branches are converted concurrently and share the cache of the mapped files, the result must not
+    // depend on the order in which they load the same file
+    for (size_t i = 0; i < 10; ++i) {
+        const auto model = core.read_model(path);
+        for (const bool condition : {true, false}) {
+            auto test_case = test::TestCase(model);
+            test_case.add_input<bool>(Shape{1}, {condition});
+            test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+            if (condition) {
+                test_case.add_expected_output<float>(Shape{2, 2}, {2.f, 4.f, 6.f, 8.f});
+            } else {
+                test_case.add_expected_output<float>(Shape{2, 2}, {1.f, 4.f, 9.f, 16.f});
+            }
+            test_case.run();
+        }
+    }
+}
+
+TEST_P(OnnxFeMmapFixture, onnx_external_data_in_if_branch_file_not_found) {
+    try {
+        const auto path = test::utils::getModelFromTestModelZoo(
+            string(TEST_ONNX_MODELS_DIRNAME) + "external_data/external_data_in_if_branch_file_not_found.onnx");
+        Core core;
+        core.set_property(enable_mmap(GetParam()));
+        core.read_model(path);
+        FAIL() << "Incorrect path to external data in a subgraph not detected";
+    } catch (const Exception& ex) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            string("not_existed_file.data, offset: 4096, data_length: 16)"),
+                            ex.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
@@ -10,6 +10,7 @@
 #include "openvino/frontend/tensorflow/variable.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/runtime/lazy_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/tensor_bundle.pb.h"
@@ -23,6 +24,9 @@ namespace frontend {
 namespace tensorflow {
 namespace op {
 
+// Variables of this size and bigger are loaded from the shard file on first access
+constexpr uint64_t lazy_loading_threshold = 0x100000;  // 1MB
+
 // Reading variable from shard file
 template <typename T>
 static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> var_index,
@@ -54,7 +58,6 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                                                                               mapped_memory));
     } else {
         std::vector<T> var_data;
-        var_data.resize(size);
         auto fs = var_index->get_data_file(entry.shard_id());
         if (!fs.get()) {
             TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
@@ -72,6 +75,21 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                                      entry.size(),
                                      file_size,
                                      "[TensorFlow Frontend] Variable data (stream)");
+        // Loading on first access lets a plugin overlap reading the weights with compilation,
+        // the data is read by several threads then
+        if (entry.size() >= lazy_loading_threshold) {
+            const auto lazy = std::make_shared<ov::LazyBuffer>(var_index->get_data_path(entry.shard_id()),
+                                                               static_cast<size_t>(entry.offset()),
+                                                               static_cast<size_t>(entry.size()));
+            return std::make_shared<v0::Constant>(
+                ov_type,
+                shape,
+                std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                    static_cast<char*>(lazy->get_reserved_ptr()),
+                    lazy->size(),
+                    lazy));
+        }
+        var_data.resize(size);
         fs->seekg(entry.offset(), std::ios::beg);
         fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
         return std::make_shared<v0::Constant>(ov_type, shape, var_data);
@@ -230,6 +230,7 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream,
             fullPath += ".";
             fullPath += suffix.data();
         }
+        m_data_files[shard].path = fullPath;
         if (m_mmap_enabled) {
             m_data_files[shard].mmap = load_mmap_object(fullPath);
             FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
@@ -22,6 +22,7 @@ using HashTableKeysValuesMap = std::unordered_map<std::string, std::shared_ptr<o
 struct VIBlock;
 
 struct VariableStorage {
+    std::filesystem::path path;
     std::shared_ptr<std::ifstream> stream;
     std::shared_ptr<ov::MappedMemory> mmap;
 };
@@ -115,6 +116,14 @@ public:
         return result != m_data_files.end() ? result->second.mmap : nullptr;
     }
 
+    /// \brief Returns path to data file with specific shard id
+    /// \param shard_id Shard ID of data file
+    /// \returns Path to the data file, empty if the shard isn't found
+    std::filesystem::path get_data_path(const int32_t shard_id) const {
+        auto result = m_data_files.find(shard_id);
+        return result != m_data_files.end() ? result->second.path : std::filesystem::path{};
+    }
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
@@ -2,10 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <filesystem>
+
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "conversion_with_reference.hpp"
 #include "gtest/gtest.h"
 #include "openvino/frontend/exception.hpp"
+#include "openvino/frontend/manager.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/gather.hpp"
@@ -14,6 +19,7 @@
 #include "openvino/op/result.hpp"
 #include "openvino/op/subtract.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace std;
 using namespace ov;
@@ -169,6 +175,73 @@ TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMMAPCompare) {
     { model_ref = convert_model("saved_model_variables", nullptr, {}, {}, {}, {}, {}, true); }
 }
 
+namespace {
+shared_ptr<Model> convert_saved_model(const std::filesystem::path& model_path, bool enable_mmap) {
+    frontend::FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_FE);
+    auto input_model = front_end->load({model_path.string(), enable_mmap});
+    return front_end->convert(input_model);
+}
+
+vector<shared_ptr<v0::Constant>> get_constants(const shared_ptr<Model>& model) {
+    vector<shared_ptr<v0::Constant>> constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = as_type_ptr<v0::Constant>(op)) {
+            constants.push_back(constant);
+        }
+    }
+    return constants;
+}
+}  // namespace
+
+// The variables of 1MB and bigger are read from the shard file on first access when mmap is disabled
+TEST(FrontEndConvertModelTest, SavedModelLargeVariableLazyLoading) {
+    const auto model_path = std::filesystem::path(
+        FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) + "saved_model_large_variable"));
+    const auto test_dir = std::filesystem::path(ov::test::utils::generateTestFilePrefix());
+    const auto copied_model_path = test_dir / "saved_model_large_variable";
+    std::filesystem::create_directories(test_dir);
+    std::filesystem::copy(model_path, copied_model_path, std::filesystem::copy_options::recursive);
+
+    const auto model_ref = convert_saved_model(model_path, true);
+    const auto model = convert_saved_model(copied_model_path, false);
+    const auto model_not_read = convert_saved_model(copied_model_path, false);
+
+    // the values loaded on access match the mapped ones
+    const auto constants_ref = get_constants(model_ref);
+    const auto constants = get_constants(model);
+    ASSERT_EQ(constants.size(), constants_ref.size());
+    size_t large_constants = 0;
+    for (size_t i = 0; i < constants.size(); ++i) {
+        ASSERT_EQ(constants[i]->get_element_type(), constants_ref[i]->get_element_type());
+        ASSERT_EQ(constants[i]->get_shape(), constants_ref[i]->get_shape());
+        ASSERT_EQ(std::memcmp(constants[i]->get_data_ptr(),
+                              constants_ref[i]->get_data_ptr(),
+                              constants[i]->get_byte_size()),
+                  0)
+            << "Values of constant " << constants[i]->get_friendly_name() << " differ";
+        if (constants[i]->get_byte_size() >= 0x100000) {
+            ++large_constants;
+        }
+    }
+    ASSERT_EQ(large_constants, 1);
+
+    // the data of the large variable is not read by the conversion, so it is not available without the files,
+    // while the small variable is read eagerly
+    std::filesystem::remove_all(test_dir);
+    size_t checked_constants = 0;
+    for (const auto& constant : get_constants(model_not_read)) {
+        if (constant->get_byte_size() >= 0x100000) {
+            EXPECT_THROW(constant->get_data_ptr(), ov::Exception);
+            ++checked_constants;
+        } else if (constant->get_shape() == Shape{1024}) {
+            EXPECT_NO_THROW(constant->get_data_ptr());
+            ++checked_constants;
+        }
+    }
+    EXPECT_EQ(checked_constants, 2);
+}
+
 TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelWithNumericalNames) {
     comparator.enable(FunctionsComparator::CmpValues::TENSOR_NAMES);
     // The test aims to check that model with only numerical names for operation
@@ -0,0 +1,22 @@
+# Copyright (C) 2018-2026 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import numpy as np
+import tensorflow as tf
+
+
+# The big variable exceeds the size loaded lazily by the frontend, the small one is read eagerly
+class MulLargeVariable(tf.Module):
+  def __init__(self):
+    super(MulLargeVariable, self).__init__()
+    self.large_var = tf.Variable(np.arange(512 * 1024, dtype=np.float32).reshape([512, 1024]) / 1024.0)
+    self.small_var = tf.Variable(np.arange(1024, dtype=np.float32))
+  @tf.function(input_signature=[tf.TensorSpec([1024], tf.float32)])
+  def __call__(self, x):
+    return {'test_output_name': x * self.large_var + self.small_var}
+
+module = MulLargeVariable()
+tf.saved_model.save(module, os.path.join(sys.argv[1], "saved_model_large_variable"))
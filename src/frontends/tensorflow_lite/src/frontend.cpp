@@ -71,10 +71,13 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
     if (variants.size() == 1 + extra_variants_num) {
+        // Enable mmap by default
+        const bool mmap_enabled = extra_variants_num == 0 || variants[variants.size() - 1].as<bool>();
         if (const auto path = ov::frontend::get_path_from_any(variants[0])) {
             if (GraphIteratorFlatBuffer::is_supported(*path)) {
-                return std::make_shared<tensorflow_lite::InputModel>(std::make_shared<GraphIteratorFlatBuffer>(*path),
-                                                                     m_telemetry);
+                return std::make_shared<tensorflow_lite::InputModel>(
+                    std::make_shared<GraphIteratorFlatBuffer>(*path, mmap_enabled),
+                    m_telemetry);
             }
         } else if (variants[0].is<GraphIterator::Ptr>()) {
             auto graph_iterator = variants[0].as<GraphIterator::Ptr>();
@@ -7,23 +7,38 @@
 #include <map>
 
 #include "decoder_flatbuffer.h"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 using namespace ov::frontend::tensorflow_lite;
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::filesystem::path& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::filesystem::path& path, bool enable_mmap) {
+    FRONT_END_GENERAL_CHECK(util::file_exists(path), "Model file does not exist: ", path);
+    if (enable_mmap) {
+        auto mapped_memory = ov::load_mmap_object(path);
+        m_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped_memory->data(),
+                                                                                          mapped_memory->size(),
+                                                                                          mapped_memory);
+    } else {
+        std::ifstream model_file(path, std::ios::binary | std::ios::in);
+        FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+        const auto file_size = util::file_size(path);
+        FRONT_END_GENERAL_CHECK(file_size >= 0, "Failed to get size of the model file: ", path);
+        m_buffer = std::make_shared<ov::AlignedBuffer>(static_cast<size_t>(file_size));
+        model_file.read(m_buffer->get_ptr<char>(), static_cast<std::streamsize>(file_size));
+        FRONT_END_GENERAL_CHECK(model_file.gcount() == static_cast<std::streamsize>(file_size),
+                                "Failed to read the model file: ",
+                                path);
+    }
 
-    flatbuffers::Verifier verifier(m_data.data(), m_data.size());
+    const auto data = m_buffer->get_ptr<uint8_t>();
+    flatbuffers::Verifier verifier(data, m_buffer->size());
     FRONT_END_GENERAL_CHECK(tflite::VerifyModelBuffer(verifier),
                             "TensorFlow Lite Frontend: the model file ",
                             path,
                             " is corrupted or malformed (FlatBuffer verification failed).");
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(data);
     FRONT_END_GENERAL_CHECK(m_model != nullptr, "Failed to parse TFLite model from file: ", path);
     auto sub_graphs = m_model->subgraphs();
     FRONT_END_GENERAL_CHECK(sub_graphs && sub_graphs->size() > 0, "TFLite model has no subgraphs in file: ", path);
@@ -51,6 +66,7 @@ std::shared_ptr<GraphIterator> GraphIteratorFlatBuffer::get_subgraph(size_t idx)
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_buffer = m_buffer;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
@@ -11,6 +11,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow_lite/decoder.hpp"
 #include "openvino/frontend/tensorflow_lite/graph_iterator.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "schema_generated.h"
 
@@ -25,7 +26,8 @@ struct TensorInfo {
 
 class GraphIteratorFlatBuffer : public GraphIterator {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    // Model file content: memory mapped or read, shared with the subgraph iterators and the constants
+    std::shared_ptr<ov::AlignedBuffer> m_buffer;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -33,12 +35,17 @@ class GraphIteratorFlatBuffer : public GraphIterator {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::filesystem::path& path);
+    explicit GraphIteratorFlatBuffer(const std::filesystem::path& path, bool enable_mmap = true);
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
 
     ~GraphIteratorFlatBuffer() = default;
 
+    /// Returns the buffer holding the model file content, constants data can be shared from it without copying
+    const std::shared_ptr<ov::AlignedBuffer>& get_buffer() const {
+        return m_buffer;
+    }
+
     /// Verifies file is supported
     static bool is_supported(const std::filesystem::path& path) {
         FRONT_END_GENERAL_CHECK(util::file_exists(path), "Could not open the file: ", path);
@@ -7,9 +7,11 @@
 #include <iterator>
 #include <queue>
 
+#include "graph_iterator_flatbuffer.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -47,6 +49,30 @@ std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace> decode_output_te
     const auto& tensor_meta_info = decoder->get_output_tensor_info(idx);
     return decode_tensor_place(tensor_meta_info, model);
 }
+
+std::shared_ptr<ov::op::v0::Constant> create_constant(
+    const std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace>& place,
+    const void* data,
+    const std::shared_ptr<ov::AlignedBuffer>& model_buffer) {
+    const auto& type = place->get_element_type();
+    const auto shape = place->get_partial_shape().to_shape();
+    // The constant is a view over the model buffer if the data lies there (densified sparse tensors don't)
+    if (model_buffer && type != ov::element::string) {
+        const auto byte_size = ov::util::get_memory_size_safe(type, shape);
+        const auto buffer_begin = model_buffer->get_ptr<const char>();
+        const auto buffer_end = buffer_begin + model_buffer->size();
+        const auto data_begin = static_cast<const char*>(data);
+        if (byte_size.has_value() && data_begin >= buffer_begin && data_begin <= buffer_end &&
+            byte_size.value() <= static_cast<size_t>(buffer_end - data_begin)) {
+            auto shared_data = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                const_cast<char*>(data_begin),
+                byte_size.value(),
+                model_buffer);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, shared_data);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
 }  // namespace
 
 namespace ov {
@@ -113,6 +139,10 @@ private:
 
 void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
+    std::shared_ptr<ov::AlignedBuffer> model_buffer;
+    if (const auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator)) {
+        model_buffer = flatbuffer_iterator->get_buffer();
+    }
 
     m_op_places.reserve(m_graph_iterator->size());
     for (; !m_graph_iterator->is_end(); m_graph_iterator->next()) {
@@ -165,9 +195,7 @@ void InputModel::InputModelTFLiteImpl::load_model() {
                                                 required_size_opt.value(),
                                                 " bytes). The model file may be corrupted.");
                     }
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(place, data, model_buffer);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
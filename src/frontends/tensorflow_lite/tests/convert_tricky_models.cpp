@@ -2,6 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_case.hpp"
@@ -10,7 +16,10 @@
 #include "common_test_utils/type_prop.hpp"
 #include "conversion_extension.hpp"
 #include "gtest/gtest.h"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/op/constant.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace ov;
 using namespace ov::frontend::tensorflow_lite::tests;
@@ -28,3 +37,46 @@ OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_densify) {
     test_case.add_expected_output<float>(Shape{1, 2, 2, 4}, {2, 1, 0, 0, 0, 3, 1, 0, 0, 2, 0, 0, 2, 0, 1, 0});
     test_case.run();
 }
+
+OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_constants_share_model_buffer) {
+    const auto path = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) +
+                                                         "2in_2out/2in_2out.tflite");
+    std::ifstream file(path, std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+    const std::vector<char> content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    std::shared_ptr<Model> model;
+    {
+        ov::frontend::FrontEndManager fem;
+        auto front_end = fem.load_by_framework(TF_LITE_FE);
+        ASSERT_NE(front_end, nullptr);
+        auto input_model = front_end->load(path);
+        ASSERT_NE(input_model, nullptr);
+        model = front_end->convert(input_model);
+        ASSERT_NE(model, nullptr);
+    }
+    // The frontend and the input model are destroyed, the constants keep the model buffer alive
+
+    // A constant which is a view over the model buffer is placed at the same distance from the buffer beginning as
+    // its data from the file beginning, so such constants vote for one buffer address
+    std::map<const char*, size_t> votes;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant || constant->get_byte_size() < sizeof(float)) {
+            continue;
+        }
+        const auto data = static_cast<const char*>(constant->get_data_ptr());
+        const auto size = constant->get_byte_size();
+        for (size_t offset = 0; offset + size <= content.size(); offset++) {
+            if (std::memcmp(content.data() + offset, data, size) == 0) {
+                votes[data - offset]++;
+            }
+        }
+    }
+    size_t shared_constants = 0;
+    for (const auto& vote : votes) {
+        shared_constants = std::max(shared_constants, vote.second);
+    }
+    // the weights of the model are not copied, e.g. the convolution kernels, the added constant and the paddings
+    ASSERT_GE(shared_constants, 2);
+}
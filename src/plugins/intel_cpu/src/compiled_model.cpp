@@ -5,17 +5,24 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
+#include "expert_cache.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
@@ -24,6 +31,10 @@
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/symbol.hpp"
+#include "openvino/pass/manager.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -34,7 +45,9 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "perf_count.h"
 #include "sub_memory_manager.hpp"
+#include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/graph_serializer/serializer.hpp"
@@ -53,6 +66,33 @@ using namespace ov::threading;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+std::string format_sampled_perf_report(const std::vector<SampledPerfRecord>& perfData) {
+    auto to_us = [](uint64_t ns) {
+        return static_cast<double>(ns) / 1000.0;
+    };
+
+    std::ostringstream report;
+    report << "node,type,samples,mean_us,p50_us,p90_us,p99_us\n";
+    std::array<uint64_t, 3> categoryTotal{};
+    for (const auto& record : perfData) {
+        const auto& histogram = record.histogram;
+        report << record.node_name << ',' << record.node_type << ',' << histogram.count() << ','
+               << to_us(histogram.avg()) << ',' << to_us(histogram.percentile(0.5)) << ','
+               << to_us(histogram.percentile(0.9)) << ',' << to_us(histogram.percentile(0.99)) << '\n';
+        categoryTotal[static_cast<size_t>(record.category)] += histogram.total();
+    }
+
+    report << "category,total_us\n";
+    report << "compute," << to_us(categoryTotal[static_cast<size_t>(SampledPerfRecord::Category::Compute)]) << '\n';
+    report << "reorder," << to_us(categoryTotal[static_cast<size_t>(SampledPerfRecord::Category::Reorder)]) << '\n';
+    report << "convert," << to_us(categoryTotal[static_cast<size_t>(SampledPerfRecord::Category::Convert)]) << '\n';
+    return report.str();
+}
+
+}  // namespace
+
 struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -67,7 +107,7 @@ CompiledModel::~CompiledModel() {
         m_sub_memory_manager->_memorys_table.clear();
     }
     auto streamsExecutor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_task_executor);
-    if (streamsExecutor) {
+    if (streamsExecutor && !m_is_shape_bucket) {
         streamsExecutor->cpu_reset();
     }
     CPU_DEBUG_CAP_ENABLE(dumpMemoryStats(m_cfg.debugCaps, m_name, m_graphs, m_socketWeights));
@@ -86,6 +126,11 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    m_perfSampler = std::make_shared<PerfSampler>();
+    m_perfSampler->setInterval(m_cfg.profilingSamplingInterval);
+    if (m_cfg.moeExpertCacheSize > 0) {
+        m_expertCache = std::make_shared<ExpertCache>(m_cfg.moeExpertCacheSize);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -118,12 +163,67 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
+    m_streams = executor_config.get_streams();
+    init_graphs();
+    if (m_cfg.numSubStreams > 0) {
+        m_has_sub_compiled_models = true;
+        auto sub_cfg = m_cfg;
+        sub_cfg.numSubStreams = 0;
+        sub_cfg.enableNodeSplit = true;
+        auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
+        auto message = message_manager();
+        m_sub_memory_manager = std::make_shared<SubMemoryManager>(m_cfg.numSubStreams);
+        message->set_num_sub_streams(m_cfg.numSubStreams);
+        for (int i = 0; i < m_cfg.numSubStreams; i++) {
+            std::vector<std::vector<int>> sub_streams_table;
+            sub_streams_table.push_back(streams_info_table[i + 1]);
+            sub_streams_table[0][NUMBER_OF_STREAMS] = 1;
+            sub_cfg.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
+                                                                    1,
+                                                                    1,
+                                                                    ov::hint::SchedulingCoreType::ANY_CORE,
+                                                                    false,
+                                                                    true,
+                                                                    true,
+                                                                    std::move(sub_streams_table),
+                                                                    sub_cfg.streamsRankTable[i]};
+            m_sub_compiled_models.push_back(
+                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+        }
+    } else if (!m_cfg.shapeBuckets.empty()) {
+        create_shape_buckets();
+    }
+}
+
+CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model, const CompiledModel& parent)
+    : ov::ICompiledModel::ICompiledModel(model,
+                                         parent.m_plugin,
+                                         parent.m_task_executor,
+                                         parent.m_callback_executor),
+      m_model(model),
+      m_plugin(parent.m_plugin),
+      m_task_executor(parent.m_task_executor),
+      m_callback_executor(parent.m_callback_executor),
+      m_mutex(parent.m_mutex),
+      m_cfg(parent.m_cfg),
+      m_name{model->get_name()},
+      m_loaded_from_cache(parent.m_loaded_from_cache),
+      m_socketWeights(parent.m_socketWeights),
+      m_perfSampler(parent.m_perfSampler),
+      m_is_shape_bucket(true),
+      m_expertCache(parent.m_expertCache),
+      m_optimized_single_stream(parent.m_optimized_single_stream),
+      m_streams(parent.m_streams) {
+    m_cfg.shapeBuckets.clear();
+    init_graphs();
+}
 
-    int streams = std::max(1, executor_config.get_streams());
+void CompiledModel::init_graphs() {
+    int streams = std::max(1, m_streams);
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
-    if (executor_config.get_streams() != 0) {
+    if (m_streams != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
                 return graph.IsReady();
@@ -147,32 +247,6 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         CompiledModel::get_graph();
     }
-    if (m_cfg.numSubStreams > 0) {
-        m_has_sub_compiled_models = true;
-        auto sub_cfg = m_cfg;
-        sub_cfg.numSubStreams = 0;
-        sub_cfg.enableNodeSplit = true;
-        auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
-        auto message = message_manager();
-        m_sub_memory_manager = std::make_shared<SubMemoryManager>(m_cfg.numSubStreams);
-        message->set_num_sub_streams(m_cfg.numSubStreams);
-        for (int i = 0; i < m_cfg.numSubStreams; i++) {
-            std::vector<std::vector<int>> sub_streams_table;
-            sub_streams_table.push_back(streams_info_table[i + 1]);
-            sub_streams_table[0][NUMBER_OF_STREAMS] = 1;
-            sub_cfg.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
-                                                                    1,
-                                                                    1,
-                                                                    ov::hint::SchedulingCoreType::ANY_CORE,
-                                                                    false,
-                                                                    true,
-                                                                    true,
-                                                                    std::move(sub_streams_table),
-                                                                    sub_cfg.streamsRankTable[i]};
-            m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
-        }
-    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -207,11 +281,13 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_expertCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
+                graphLock._graph.SetPerfSampler(m_perfSampler);
                 graphLock._graph.Activate();
             } catch (...) {
                 exception = std::current_exception();
@@ -265,6 +341,35 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
+    if (name == ov::intel_cpu::profiling_sampling_interval) {
+        return decltype(ov::intel_cpu::profiling_sampling_interval)::value_type(m_perfSampler->getInterval());
+    }
+    if (name == ov::intel_cpu::shape_bucket_statistics) {
+        decltype(ov::intel_cpu::shape_bucket_statistics)::value_type statistics;
+        for (size_t i = 0; i < m_shape_buckets.size(); i++) {
+            statistics[std::to_string(m_shape_buckets[i].size)] = m_shape_bucket_hits[i].load();
+        }
+        statistics["dynamic"] = m_shape_bucket_hits.empty() ? 0 : m_shape_bucket_hits.back().load();
+        return statistics;
+    }
+    if (name == ov::intel_cpu::moe_expert_cache_statistics) {
+        decltype(ov::intel_cpu::moe_expert_cache_statistics)::value_type statistics;
+        if (m_expertCache) {
+            const auto stats = m_expertCache->getStatistics();
+            statistics["hits"] = stats.hits;
+            statistics["misses"] = stats.misses;
+            statistics["evictions"] = stats.evictions;
+            statistics["resident_bytes"] = stats.resident_bytes;
+            statistics["resident_experts"] = stats.resident_experts;
+            statistics["pinned_bytes"] = stats.pinned_bytes;
+        }
+        return statistics;
+    }
+    if (name == ov::intel_cpu::profiling_report) {
+        std::vector<SampledPerfRecord> perfData;
+        get_sampled_perf_data(perfData);
+        return decltype(ov::intel_cpu::profiling_report)::value_type(format_sampled_perf_report(perfData));
+    }
 
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
@@ -414,6 +519,48 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& property : properties) {
+        if (property.first != ov::intel_cpu::profiling_sampling_interval.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           property.first,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+
+    for (const auto& property : properties) {
+        uint32_t interval = 0;
+        try {
+            interval = property.second.as<uint32_t>();
+        } catch (const ov::Exception&) {
+            OPENVINO_THROW("Wrong value ",
+                           property.second.as<std::string>(),
+                           " for property key ",
+                           ov::intel_cpu::profiling_sampling_interval.name(),
+                           ". Expected only unsigned integer numbers");
+        }
+        m_perfSampler->setInterval(interval);
+    }
+
+    for (const auto& model : m_sub_compiled_models) {
+        model->set_property(properties);
+    }
+}
+
+void CompiledModel::get_sampled_perf_data(std::vector<SampledPerfRecord>& perfData) const {
+    for (auto& graph : m_graphs) {
+        GraphGuard::Lock lock(graph);
+        if (lock._graph.IsReady()) {
+            lock._graph.GetSampledPerfData(perfData);
+        }
+    }
+
+    for (const auto& model : m_sub_compiled_models) {
+        model->get_sampled_perf_data(perfData);
+    }
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
     serializer << m_model;
@@ -429,6 +576,99 @@ void CompiledModel::release_memory() {
         auto ctx = graph.getGraphContext();
         ctx->releaseMemory();
     }
+
+    for (const auto& bucket : m_shape_buckets) {
+        bucket.model->release_memory();
+    }
+}
+
+void CompiledModel::create_shape_buckets() {
+    const auto axis = m_cfg.shapeBucketAxis;
+    // the buckets are kept in the exported model, so the imported one rebuilds them
+    m_model->set_rt_info(m_cfg.shapeBuckets, "runtime_options", ov::intel_cpu::shape_buckets.name());
+    m_model->set_rt_info(axis, "runtime_options", ov::intel_cpu::shape_bucket_axis.name());
+    m_shape_bucket_hits = std::vector<std::atomic<uint64_t>>(1);
+    if (!m_model->is_dynamic() || !m_model->get_variables().empty()) {
+        return;
+    }
+
+    // The bucketed dimension of all the inputs gets one symbol, which is propagated to the outputs. Any other dynamic
+    // dimension of an output depends on the padded positions, so the valid part of such output can't be sliced.
+    std::vector<std::vector<size_t>> output_axes;
+    try {
+        const auto model = m_model->clone();
+        const auto symbol = std::make_shared<ov::Symbol>();
+        for (const auto& parameter : model->get_parameters()) {
+            auto shape = parameter->get_partial_shape();
+            if (is_bucketed(shape, axis)) {
+                shape[axis].set_symbol(symbol);
+                parameter->set_partial_shape(shape);
+            }
+        }
+        ov::pass::Manager manager("CPU:ShapeBuckets");
+        manager.register_pass<ov::pass::SymbolicPropagation>();
+        manager.run_passes(model);
+
+        for (const auto& output : model->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            if (shape.rank().is_dynamic()) {
+                return;
+            }
+            std::vector<size_t> axes;
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (shape[i].is_dynamic()) {
+                    if (!ov::symbol::are_equal(shape[i].get_symbol(), symbol)) {
+                        DEBUG_LOG("Shape buckets are disabled: the output ", output, " is not sliceable");
+                        return;
+                    }
+                    axes.push_back(i);
+                }
+            }
+            output_axes.push_back(std::move(axes));
+        }
+    } catch (const ov::Exception& e) {
+        DEBUG_LOG("Shape buckets are disabled: ", e.what());
+        return;
+    }
+
+    // The variants are reshaped from the transformed model, so they share its constants and the packed weights in
+    // the weights cache
+    std::vector<ShapeBucket> buckets;
+    for (const auto bucket : m_cfg.shapeBuckets) {
+        const auto bucket_model = m_model->clone();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+        for (const auto& input : bucket_model->inputs()) {
+            auto shape = input.get_partial_shape();
+            if (is_bucketed(shape, axis)) {
+                shape[axis] = bucket;
+                new_shapes.emplace(input, shape);
+            }
+        }
+        if (new_shapes.empty()) {
+            // none of the inputs is dynamic along the bucketed axis
+            break;
+        }
+        bucket_model->reshape(new_shapes);
+        if (bucket_model->is_dynamic()) {
+            // the other dynamic dimensions would be inferred on every inference anyway
+            DEBUG_LOG("Shape buckets are disabled: the model is dynamic along other dimensions");
+            break;
+        }
+        buckets.push_back({bucket, std::make_shared<CompiledModel>(bucket_model, *this)});
+    }
+
+    m_shape_buckets = std::move(buckets);
+    m_shape_bucket_output_axes = std::move(output_axes);
+    m_shape_bucket_hits = std::vector<std::atomic<uint64_t>>(m_shape_buckets.size() + 1);
+}
+
+int CompiledModel::find_shape_bucket(int64_t length) const {
+    auto bucket = std::find_if(m_shape_buckets.begin(), m_shape_buckets.end(), [length](const ShapeBucket& b) {
+        return length >= 0 && length <= b.size;
+    });
+    const auto idx = static_cast<size_t>(std::distance(m_shape_buckets.begin(), bucket));
+    m_shape_bucket_hits[idx].fetch_add(1, std::memory_order_relaxed);
+    return bucket == m_shape_buckets.end() ? -1 : static_cast<int>(idx);
 }
 
 }  // namespace ov::intel_cpu
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -14,15 +15,18 @@
 #include <vector>
 
 #include "config.h"
+#include "expert_cache.hpp"
 #include "graph.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/partial_shape.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "perf_count.h"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -46,6 +50,12 @@ public:
                   bool loaded_from_cache,
                   std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
 
+    /**
+     * @brief Creates the static variant of the \p parent model for a shape bucket. The variant runs on the executors
+     * of the parent and shares its weights and MoE expert caches.
+     */
+    CompiledModel(const std::shared_ptr<ov::Model>& model, const CompiledModel& parent);
+
     ~CompiledModel() override;
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
@@ -56,10 +66,7 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -67,6 +74,32 @@ public:
         return m_name;
     }
 
+    struct ShapeBucket {
+        int64_t size;
+        std::shared_ptr<CompiledModel> model;
+    };
+
+    /**
+     * @brief Checks whether the dimension \p axis of the \p shape is a subject to the shape bucketing
+     */
+    static bool is_bucketed(const ov::PartialShape& shape, int64_t axis) {
+        return shape.rank().is_static() && axis < shape.rank().get_length() && shape[axis].is_dynamic();
+    }
+
+    /**
+     * @brief Returns the index of the smallest shape bucket which fits the \p length or -1 if there is no such bucket,
+     * i.e. the inference has to be performed on the dynamic graph. The result is accounted in the bucket statistics.
+     */
+    int find_shape_bucket(int64_t length) const;
+
+    /**
+     * @brief Returns the dimensions of the output \p idx which are equal to the bucketed dimension of the inputs, so
+     * they are sliced back from the bucket size to the actual length
+     */
+    const std::vector<size_t>& shape_bucket_output_axes(size_t idx) const {
+        return m_shape_bucket_output_axes[idx];
+    }
+
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
@@ -87,6 +120,17 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime switch of the sampling profiler shared by all the graphs
+    std::shared_ptr<PerfSampler> m_perfSampler;
+
+    // static variants of the dynamic model sorted by the bucket size, the last counter is for the dynamic fallback
+    std::vector<ShapeBucket> m_shape_buckets;
+    mutable std::vector<std::atomic<uint64_t>> m_shape_bucket_hits;
+    std::vector<std::vector<size_t>> m_shape_bucket_output_axes;
+    // the variant of a shape bucket does not own the executors of the parent model
+    bool m_is_shape_bucket = false;
+    // packed MoE experts shared by all the graphs, nullptr if the experts are packed at compile time
+    ExpertCache::Ptr m_expertCache;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,14 +138,20 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    void init_graphs();
+    void create_shape_buckets();
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
 
+    void get_sampled_perf_data(std::vector<SampledPerfRecord>& perfData) const;
+
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+    int m_streams = 0;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -144,6 +194,22 @@ public:
         return m_compiled_model->name();
     }
 
+    [[nodiscard]] const std::vector<CompiledModel::ShapeBucket>& shape_buckets() const {
+        return m_compiled_model->m_shape_buckets;
+    }
+
+    [[nodiscard]] int64_t shape_bucket_axis() const {
+        return m_compiled_model->m_cfg.shapeBucketAxis;
+    }
+
+    [[nodiscard]] int find_shape_bucket(int64_t length) const {
+        return m_compiled_model->find_shape_bucket(length);
+    }
+
+    [[nodiscard]] const std::vector<size_t>& shape_bucket_output_axes(size_t idx) const {
+        return m_compiled_model->shape_bucket_output_axes(idx);
+    }
+
     [[nodiscard]] std::shared_ptr<const ov::ICompiledModel> compiled_model() const {
         return m_compiled_model;
     }
@@ -223,6 +223,60 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::enable_profiling.name(),
                                ". Expected only true/false");
             }
+        } else if (key == ov::intel_cpu::profiling_sampling_interval.name()) {
+            try {
+                profilingSamplingInterval = val.as<uint32_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::profiling_sampling_interval.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::shape_buckets.name()) {
+            try {
+                shapeBuckets = val.as<std::vector<int64_t>>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shape_buckets.name(),
+                               ". Expected a list of positive integer numbers");
+            }
+            OPENVINO_ASSERT(std::all_of(shapeBuckets.begin(),
+                                        shapeBuckets.end(),
+                                        [](int64_t bucket) {
+                                            return bucket > 0;
+                                        }),
+                            "Wrong value for property key ",
+                            ov::intel_cpu::shape_buckets.name(),
+                            ". Expected a list of positive integer numbers");
+            std::sort(shapeBuckets.begin(), shapeBuckets.end());
+            shapeBuckets.erase(std::unique(shapeBuckets.begin(), shapeBuckets.end()), shapeBuckets.end());
+        } else if (key == ov::intel_cpu::shape_bucket_axis.name()) {
+            try {
+                shapeBucketAxis = val.as<int64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shape_bucket_axis.name(),
+                               ". Expected only non negative integer numbers");
+            }
+            OPENVINO_ASSERT(shapeBucketAxis >= 0,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::shape_bucket_axis.name(),
+                            ". Expected only non negative integer numbers");
+        } else if (key == ov::intel_cpu::moe_expert_cache_size.name()) {
+            try {
+                moeExpertCacheSize = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::moe_expert_cache_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (key == ov::internal::exclusive_async_requests.name()) {
             try {
                 exclusiveAsyncRequests = val.as<bool>();
@@ -286,6 +340,9 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+            if (val_i <= 0) {
+                shapeInferCacheCapacity = 0;
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -618,6 +675,15 @@ void Config::applyRtInfo(const std::shared_ptr<const ov::Model>& model) {
         this->valueCacheGroupSize =
             model->get_rt_info<uint64_t>({"runtime_options", ov::value_cache_group_size.name()});
     }
+    // set by the compiled model with shape buckets, so the exported model keeps them
+    if (shapeBuckets.empty() && model->has_rt_info({"runtime_options", ov::intel_cpu::shape_buckets.name()})) {
+        this->shapeBuckets =
+            model->get_rt_info<std::vector<int64_t>>({"runtime_options", ov::intel_cpu::shape_buckets.name()});
+        if (model->has_rt_info({"runtime_options", ov::intel_cpu::shape_bucket_axis.name()})) {
+            this->shapeBucketAxis =
+                model->get_rt_info<int64_t>({"runtime_options", ov::intel_cpu::shape_bucket_axis.name()});
+        }
+    }
 }
 
 }  // namespace ov::intel_cpu
@@ -51,6 +51,10 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    uint32_t profilingSamplingInterval = 0;
+    std::vector<int64_t> shapeBuckets;
+    int64_t shapeBucketAxis = 1;
+    uint64_t moeExpertCacheSize = 0;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
@@ -73,6 +77,8 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    // per node number of memoized shape inference results, see MemoizedShapeInfer
+    size_t shapeInferCacheCapacity = 64UL;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "expert_cache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "cpu_memory.h"
+#include "openvino/core/except.hpp"
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+MemoryPtr ExpertCache::get(const std::string& key, const std::function<MemoryPtr(void)>& create) {
+    {
+        std::lock_guard<std::mutex> lock(m_guard);
+        if (auto it = m_entries.find(key); it != m_entries.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second->second;
+        }
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    auto memory = create();
+    OPENVINO_ASSERT(memory, "Failed to create the packed expert weights");
+
+    std::lock_guard<std::mutex> lock(m_guard);
+    // another stream may have packed the same expert meanwhile
+    if (auto it = m_entries.find(key); it != m_entries.end()) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        return it->second->second;
+    }
+    m_lru.emplace_front(key, memory);
+    m_entries.emplace(key, m_lru.begin());
+    m_residentBytes += memory->getSize();
+    evict();
+    return memory;
+}
+
+void ExpertCache::evict() {
+    m_pinned.remove_if([](const std::weak_ptr<IMemory>& memory) {
+        return memory.expired();
+    });
+    // the most recently used entry is never evicted, so an expert larger than the budget is still usable
+    while (m_residentBytes > m_budget && m_lru.size() > 1) {
+        const auto& victim = m_lru.back();
+        m_residentBytes -= victim.second->getSize();
+        // the cache holds one reference, any other one belongs to a caller which still applies the expert
+        if (victim.second.use_count() > 1) {
+            m_pinned.emplace_back(victim.second);
+        }
+        m_entries.erase(victim.first);
+        m_lru.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+ExpertCache::Statistics ExpertCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    uint64_t pinnedBytes = 0;
+    for (auto it = m_pinned.begin(); it != m_pinned.end();) {
+        if (auto memory = it->lock()) {
+            pinnedBytes += memory->getSize();
+            ++it;
+        } else {
+            it = m_pinned.erase(it);
+        }
+    }
+    return {m_hits.load(),
+            m_misses.load(),
+            m_evictions.load(),
+            m_residentBytes,
+            static_cast<uint64_t>(m_entries.size()),
+            pinnedBytes};
+}
+
+void ExpertCache::prefetch([[maybe_unused]] const void* data, [[maybe_unused]] size_t size) {
+#if defined(__linux__)
+    if (!data || size == 0) {
+        return;
+    }
+    // madvise requires a page aligned address, the hint is advisory so the failures are ignored
+    const auto pagesize = static_cast<uintptr_t>(getpagesize());
+    const auto begin = reinterpret_cast<uintptr_t>(data);
+    const auto aligned_begin = begin & ~(pagesize - 1);
+    std::ignore = madvise(reinterpret_cast<void*>(aligned_begin),  // NOLINT(performance-no-int-to-ptr)
+                          size + (begin - aligned_begin),
+                          MADV_WILLNEED);
+#endif
+}
+
+}  // namespace ov::intel_cpu
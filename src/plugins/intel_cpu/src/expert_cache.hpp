@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "cpu_memory.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * Residency manager of the packed MoE expert weights.
+ * Instead of packing all the experts of a layer at compile time, the executors keep the original (possibly mmapped)
+ * weights and request the packed copy of an expert on demand. The packed copies are kept in the LRU order and the
+ * least recently used ones are released as soon as the total size exceeds the budget.
+ * The memory returned to a caller stays valid as long as the caller holds it, even if the entry is evicted meanwhile.
+ * Such evicted but still held entries are not resident anymore and are reported separately as the pinned ones.
+ *
+ * The cache is thread safe.
+ */
+class ExpertCache {
+public:
+    using Ptr = std::shared_ptr<ExpertCache>;
+
+    struct Statistics {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        uint64_t resident_bytes;
+        uint64_t resident_experts;
+        uint64_t pinned_bytes;  // the evicted entries which are still held by the callers
+    };
+
+    explicit ExpertCache(uint64_t budget) : m_budget(budget) {}
+
+    /**
+     * Returns the resident packed expert, creating it by \p create on a miss. The creation is performed without
+     * holding the cache lock, so the experts of different layers can be packed in parallel.
+     */
+    MemoryPtr get(const std::string& key, const std::function<MemoryPtr(void)>& create);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+    [[nodiscard]] uint64_t getBudget() const {
+        return m_budget;
+    }
+
+    /**
+     * Hints the OS to read the pages of the given memory range ahead, e.g. the mmapped source weights of the experts
+     * which are about to be packed. Does nothing on the platforms without such a hint.
+     */
+    static void prefetch(const void* data, size_t size);
+
+private:
+    using Entry = std::pair<std::string, MemoryPtr>;
+
+    void evict();
+
+    const uint64_t m_budget;
+
+    mutable std::mutex m_guard;
+    std::list<Entry> m_lru;  // the most recently used entry is at the front
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_entries;
+    uint64_t m_residentBytes = 0;
+    mutable std::list<std::weak_ptr<IMemory>> m_pinned;
+
+    std::atomic<uint64_t> m_hits = {0};
+    std::atomic<uint64_t> m_misses = {0};
+    std::atomic<uint64_t> m_evictions = {0};
+};
+
+}  // namespace ov::intel_cpu
@@ -1619,6 +1619,7 @@ inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, i
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
+    PerfSampleHelper perfSample(m_sampleCurrentInfer ? &m_sampledPerf[node.get()] : nullptr);
 
     try {
         ExecuteNode(node, request, numaId);
@@ -1654,9 +1655,31 @@ static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     return numaNodeId;
 }
 
+bool Graph::SampleCurrentInfer() {
+    if (!m_perfSampler) {
+        return false;
+    }
+
+    const auto generation = m_perfSampler->getGeneration();
+    if (generation != m_perfSamplerGeneration) {
+        // the sampling interval has been changed, start collecting from scratch
+        m_sampledPerf.clear();
+        m_sampledInferCount = 0;
+        m_perfSamplerGeneration = generation;
+    }
+
+    const auto interval = m_perfSampler->getInterval();
+    if (interval == 0) {
+        return false;
+    }
+
+    return (m_sampledInferCount++ % interval) == 0;
+}
+
 void Graph::Infer(SyncInferRequest* request) {
     DEBUG_LOG("Infer graph: ", GetName(), ". Status: ", static_cast<int>(status));
     const int numaId = GetNumaNodeId(m_context);
+    m_sampleCurrentInfer = SampleCurrentInfer();
 
     m_context->allocateMemory();
 
@@ -1679,6 +1702,7 @@ void Graph::Infer(SyncInferRequest* request) {
     if (infer_count != -1) {
         infer_count++;
     }
+    m_sampleCurrentInfer = false;
 }
 
 void Graph::SortTopologically() {
@@ -1775,6 +1799,34 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
     }
 }
 
+void Graph::GetSampledPerfData(std::vector<SampledPerfRecord>& perfData) const {
+    std::unordered_map<std::string, size_t> recordIdx;
+    for (size_t i = 0; i < perfData.size(); i++) {
+        recordIdx.emplace(perfData[i].node_name, i);
+    }
+
+    for (const auto& node : m_executableGraphNodes) {
+        const auto it = m_sampledPerf.find(node.get());
+        if (it == m_sampledPerf.end()) {
+            continue;
+        }
+
+        auto [idx, inserted] = recordIdx.emplace(node->getName(), perfData.size());
+        if (inserted) {
+            SampledPerfRecord record;
+            record.node_name = node->getName();
+            record.node_type = node->getTypeStr();
+            if (node->getType() == Type::Reorder) {
+                record.category = SampledPerfRecord::Category::Reorder;
+            } else if (node->getType() == Type::Convert) {
+                record.category = SampledPerfRecord::Category::Convert;
+            }
+            perfData.push_back(std::move(record));
+        }
+        perfData[idx->second].histogram.merge(it->second);
+    }
+}
+
 void Graph::CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
     assert(parentPort >= 0 && childPort >= 0);
 
@@ -25,6 +25,7 @@
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "perf_count.h"
 #include "proxy_mem_blk.h"
 #include "utils/general_utils.h"
 
@@ -157,6 +158,19 @@ public:
 
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
 
+    /**
+     * Attach the sampling profiler switch, which is shared between all the graphs of a compiled model
+     */
+    void SetPerfSampler(std::shared_ptr<const PerfSampler> sampler) {
+        m_perfSampler = std::move(sampler);
+    }
+
+    /**
+     * Merge the histograms collected by the sampling profiler into \p perfData.
+     * Records are matched by node name, so the results of several streams can be accumulated
+     */
+    void GetSampledPerfData(std::vector<SampledPerfRecord>& perfData) const;
+
     void CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort = 0, int childPort = 0);
     void RemoveEdge(const EdgePtr& edge);
     void RemoveDroppedNodes();
@@ -349,6 +363,7 @@ protected:
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    bool SampleCurrentInfer();
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -374,6 +389,13 @@ private:
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+
+    // sampling profiler state, the histograms are only touched by the inferences picked by the sampler
+    std::shared_ptr<const PerfSampler> m_perfSampler;
+    uint64_t m_perfSamplerGeneration = 0;
+    uint64_t m_sampledInferCount = 0;
+    bool m_sampleCurrentInfer = false;
+    mutable std::unordered_map<const Node*, PerfHistogram> m_sampledPerf;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
@@ -12,6 +12,7 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "expert_cache.hpp"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
@@ -27,9 +28,11 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           ExpertCache::Ptr expertCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
+      m_expertCache(std::move(expertCache)),
       m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
@@ -12,6 +12,7 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "expert_cache.hpp"
 #include "memory_control.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -37,7 +38,8 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 ExpertCache::Ptr expertCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -47,6 +49,10 @@ public:
         return m_weightsCache;
     }
 
+    [[nodiscard]] ExpertCache::Ptr getExpertCache() const {
+        return m_expertCache;
+    }
+
     [[nodiscard]] MultiCachePtr getParamsCache() const {
         return m_rtParamsCache;
     }
@@ -114,6 +120,8 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
+    // model-level residency manager of the packed MoE experts, nullptr if the experts are packed at compile time
+    ExpertCache::Ptr m_expertCache;
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
@@ -5,6 +5,7 @@
 #include "infer_request.h"
 
 #include <cstddef>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <map>
@@ -62,6 +63,10 @@ SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
         m_output_ports_map[output_index] = outputs[output_index];
     }
     create_infer_request();
+    for (const auto& bucket : m_compiled_model.shape_buckets()) {
+        m_shape_bucket_requests.push_back({std::make_shared<SyncInferRequest>(CompiledModelHolder(bucket.model)),
+                                           std::vector<ov::SoPtr<ov::ITensor>>(m_input_ports_map.size())});
+    }
 }
 
 void SyncInferRequest::create_infer_request() {
@@ -102,12 +107,16 @@ void SyncInferRequest::update_external_tensor_ptrs() {
 
 void SyncInferRequest::infer() {
     OV_ITT_SCOPED_TASK_BASE(itt::domains::ov_cpu_inference, m_profiling_task);
+    if (!m_shape_bucket_requests.empty() && shape_bucket_infer()) {
+        return;
+    }
+
     auto graphLock = m_compiled_model.lock();
     auto&& graph = graphLock._graph;
     auto message = ov::threading::message_manager();
 
     throw_if_canceled();
-    if (m_asyncRequest->m_has_sub_infers) {
+    if (m_asyncRequest && m_asyncRequest->m_has_sub_infers) {
         sub_streams_infer();
         message->server_wait();
         return;
@@ -655,6 +664,76 @@ void SyncInferRequest::sub_streams_infer() {
     }
 }
 
+bool SyncInferRequest::shape_bucket_infer() {
+    const auto axis = m_compiled_model.shape_bucket_axis();
+
+    // all the bucketed inputs must agree on the length, otherwise fall back to the dynamic graph
+    int64_t length = -1;
+    for (const auto& input : m_input_ports_map) {
+        if (!CompiledModel::is_bucketed(input.second.get_partial_shape(), axis)) {
+            continue;
+        }
+        const auto& tensor = get_tensor_ptr(input.second);
+        const auto dim = static_cast<int64_t>(tensor->get_shape()[axis]);
+        if (tensor->get_element_type() == element::string || !m_batched_tensors.empty() ||
+            (length != -1 && length != dim)) {
+            length = -1;
+            break;
+        }
+        length = dim;
+    }
+
+    const auto bucket_idx = m_compiled_model.find_shape_bucket(length);
+    if (bucket_idx < 0) {
+        return false;
+    }
+
+    const auto& bucket = m_compiled_model.shape_buckets()[bucket_idx];
+    auto& bucket_request = m_shape_bucket_requests[bucket_idx];
+    auto& request = *bucket_request.request;
+
+    const auto& bucket_inputs = request.get_inputs();
+    for (const auto& input : m_input_ports_map) {
+        auto tensor = get_tensor_ptr(input.second);
+        if (length != bucket.size && CompiledModel::is_bucketed(input.second.get_partial_shape(), axis)) {
+            auto padded_shape = tensor->get_shape();
+            padded_shape[axis] = bucket.size;
+            auto& padded = bucket_request.padded_inputs[input.first];
+            if (!padded || padded->get_shape() != padded_shape) {
+                padded = ov::make_tensor(tensor->get_element_type(), padded_shape);
+            }
+            // zero padding, which also masks out the padded positions of the attention mask like inputs
+            std::memset(padded->data(), 0, padded->get_byte_size());
+            const ov::Coordinate begin(padded_shape.size(), 0);
+            const ov::Coordinate end(tensor->get_shape());
+            tensor->copy_to(ov::make_tensor(padded._ptr, begin, end));
+            tensor = padded;
+        }
+        request.set_tensor(bucket_inputs[input.first], tensor);
+    }
+
+    throw_if_canceled();
+    request.infer();
+    throw_if_canceled();
+
+    const auto& bucket_outputs = request.get_outputs();
+    for (const auto& output : m_output_ports_map) {
+        auto result = request.get_tensor(bucket_outputs[output.first]);
+        auto shape = result->get_shape();
+        const auto& output_axes = m_compiled_model.shape_bucket_output_axes(output.first);
+        if (length != bucket.size && !output_axes.empty()) {
+            for (const auto output_axis : output_axes) {
+                shape[output_axis] = length;
+            }
+            result = ov::make_tensor(result._ptr, ov::Coordinate(shape.size(), 0), ov::Coordinate(shape));
+        }
+        auto tensor = get_tensor(output.second);
+        tensor->set_shape(shape);
+        result->copy_to(tensor._ptr);
+    }
+    return true;
+}
+
 void SyncInferRequest::check_tensors() const {
     // more lightweight and straight forward version specific for cpu
     auto check_tensor =
@@ -119,6 +119,17 @@ private:
 
     void sub_streams_infer();
 
+    /**
+     * @brief Dispatches the inference to the static variant of the model compiled for the matching shape bucket
+     * @return false if the inputs don't fit any bucket, so the inference has to be performed on the dynamic graph
+     */
+    bool shape_bucket_infer();
+
+    struct ShapeBucketRequest {
+        std::shared_ptr<SyncInferRequest> request;
+        std::vector<ov::SoPtr<ov::ITensor>> padded_inputs;
+    };
+
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
@@ -132,6 +143,9 @@ private:
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
+
+    // requests to the static variants of the model, one per shape bucket
+    std::vector<ShapeBucketRequest> m_shape_bucket_requests;
 };
 
 }  // namespace ov::intel_cpu
@@ -6,8 +6,10 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -20,6 +22,57 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Sampling profiler interval: every N-th inference of each stream records per node latency histograms.
+ * Zero disables sampling. Unlike ov::enable_profiling the property can be changed on a compiled model.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> profiling_sampling_interval{
+    "CPU_PROFILING_SAMPLING_INTERVAL"};
+
+/**
+ * @brief Report of the sampling profiler in CSV format: a line per executed node with the number of samples,
+ * mean and p50/p90/p99 latency in microseconds, followed by the total time spent in Reorder, Convert and other nodes.
+ */
+static constexpr Property<std::string, PropertyMutability::RO> profiling_report{"CPU_PROFILING_REPORT"};
+
+/**
+ * @brief Shape buckets for dynamic models: a static variant of the model is compiled per bucket size with the
+ * `shape_bucket_axis` dimension of the dynamic inputs set to the bucket size. An inference is dispatched to the
+ * smallest bucket which fits the inputs, the inputs are zero padded up to the bucket size and the output dimensions
+ * equal to the bucketed one are sliced back.
+ * The variants are built only if the bucketed dimension is the only dynamic one and every dynamic output dimension
+ * is equal to it. Requests exceeding the largest bucket run on the dynamic graph. Only suitable for models where zero
+ * padding doesn't affect the valid part of the outputs, e.g. transformers with an attention mask input.
+ */
+static constexpr Property<std::vector<int64_t>, PropertyMutability::RW> shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Input dimension which is bucketed by ov::intel_cpu::shape_buckets, 1 (sequence length) by default
+ */
+static constexpr Property<int64_t, PropertyMutability::RW> shape_bucket_axis{"CPU_SHAPE_BUCKET_AXIS"};
+
+/**
+ * @brief Number of inferences dispatched to each shape bucket, the "dynamic" entry counts the inferences which
+ * didn't fit any bucket
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shape_bucket_statistics{
+    "CPU_SHAPE_BUCKET_STATISTICS"};
+
+/**
+ * @brief Memory budget in bytes for the packed MoE expert weights. When set, the experts are packed on first use
+ * instead of at compile time, the weights stay in the (possibly mmapped) model blob and the least recently used packed
+ * experts are released once the budget is exceeded. 0 (default) packs all the experts at compile time.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> moe_expert_cache_size{"CPU_MOE_EXPERT_CACHE_SIZE"};
+
+/**
+ * @brief Statistics of the MoE expert cache: "hits", "misses", "evictions", "resident_bytes", "resident_experts" and
+ * "pinned_bytes". "resident_bytes" does not exceed the budget unless a single resident expert is larger than it.
+ * "pinned_bytes" is the size of the evicted experts which are still applied by the running inferences.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> moe_expert_cache_statistics{
+    "CPU_MOE_EXPERT_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -48,6 +48,8 @@
 #include "partitioned_mem_blk.h"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
+#include "shape_inference/shape_inference_memo.hpp"
+#include "shape_inference/shape_inference_pass_through.hpp"
 #include "shape_inference/shape_inference_status.hpp"
 #include "transformations/rt_info/disable_precision_conversion.hpp"
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -129,6 +131,11 @@ Node::Node(const std::shared_ptr<ov::Node>& op, GraphContext::CPtr ctx, const Sh
 
     if (isDynamic) {
         shapeInference = shapeInferFactory.makeShapeInfer();
+        const auto shapeInferCacheCapacity = context->getConfig().shapeInferCacheCapacity;
+        if (shapeInferCacheCapacity > 0 && shapeInference && shapeInference->get_port_mask() == EMPTY_PORT_MASK &&
+            !std::dynamic_pointer_cast<ShapeInferPassThrough>(shapeInference)) {
+            shapeInference = std::make_shared<MemoizedShapeInfer>(shapeInference, shapeInferCacheCapacity);
+        }
     }
 
     const auto& rtInfo = op->get_rt_info();
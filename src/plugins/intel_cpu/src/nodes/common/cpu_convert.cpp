@@ -1069,7 +1069,11 @@ void cpu_convert(const void* srcPtr,
         if (srcPrc == element::string) {
             const auto* str_src = reinterpret_cast<const StringMemory::OvString*>(srcPtr);
             auto* str_dst = reinterpret_cast<StringMemory::OvString*>(dstPtr);
-            std::copy(str_src, str_src + size, str_dst);
+            // the copy assignment reuses the capacity of the destination strings, so the copy to the same tensor
+            // allocates only for the grown strings, while the copies of the individual strings are independent
+            parallel_for(size, [&](size_t i) {
+                str_dst[i] = str_src[i];
+            });
         } else if (totalSize >= L2_cache_size) {
             const auto* src = static_cast<const uint8_t*>(srcPtr);
             auto* dst = static_cast<uint8_t*>(dstPtr);
@@ -0,0 +1,354 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_plan.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memcpy.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr std::array<size_t, 7> supportedRadices = {4, 2, 3, 5, 7, 11, 13};
+constexpr size_t maxRadix = 13;
+constexpr size_t planCacheCapacity = 64;
+constexpr double PI = 3.141592653589793238462643;
+
+struct Complex {
+    float re;
+    float im;
+};
+
+inline Complex load(const float* data, size_t index) {
+    return {data[2 * index], data[2 * index + 1]};
+}
+
+inline void store(float* data, size_t index, Complex value) {
+    data[2 * index] = value.re;
+    data[2 * index + 1] = value.im;
+}
+
+inline Complex operator+(Complex a, Complex b) {
+    return {a.re + b.re, a.im + b.im};
+}
+
+inline Complex operator-(Complex a, Complex b) {
+    return {a.re - b.re, a.im - b.im};
+}
+
+inline Complex operator*(Complex a, Complex b) {
+    return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+}
+
+inline Complex operator*(Complex a, float scale) {
+    return {a.re * scale, a.im * scale};
+}
+
+// multiplication by sign * i
+inline Complex rotateQuarter(Complex a, float sign) {
+    return {-sign * a.im, sign * a.re};
+}
+
+inline void pushRoot(std::vector<float>& values, double angle) {
+    values.push_back(static_cast<float>(std::cos(angle)));
+    values.push_back(static_cast<float>(std::sin(angle)));
+}
+
+bool isPowerOfTwo(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> radices;
+    for (const auto radix : supportedRadices) {
+        while (n % radix == 0) {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    if (n != 1) {
+        return {};
+    }
+    return radices;
+}
+
+/*
+ * One pass of the Stockham autosort FFT: the input holds radix interleaved transforms of length span, the output
+ * holds their merge into transforms of length span * radix. The innermost loop walks over consecutive elements of
+ * both buffers, so it is vectorized by the compiler.
+ */
+template <size_t Radix>
+void radixStage(const float* src,
+                float* dst,
+                size_t n,
+                size_t span,
+                const std::vector<float>& twiddles,
+                float sign) {
+    const size_t stride = n / Radix;
+    const size_t groups = stride / span;
+    for (size_t g = 0; g < groups; g++) {
+        const size_t srcOffset = g * span;
+        const size_t dstOffset = g * span * Radix;
+        for (size_t k = 0; k < span; k++) {
+            const float* tw = &twiddles[2 * k * (Radix - 1)];
+            std::array<Complex, Radix> v;
+            v[0] = load(src, srcOffset + k);
+            for (size_t q = 1; q < Radix; q++) {
+                v[q] = load(src, srcOffset + k + q * stride) * Complex{tw[2 * (q - 1)], tw[2 * (q - 1) + 1]};
+            }
+
+            const size_t base = dstOffset + k;
+            if constexpr (Radix == 2) {
+                store(dst, base, v[0] + v[1]);
+                store(dst, base + span, v[0] - v[1]);
+            } else if constexpr (Radix == 3) {
+                constexpr float sin60 = 0.866025403784438646763723F;
+                const Complex t = v[1] + v[2];
+                const Complex m = v[0] - t * 0.5F;
+                const Complex d = rotateQuarter(v[1] - v[2], sign) * sin60;
+                store(dst, base, v[0] + t);
+                store(dst, base + span, m + d);
+                store(dst, base + 2 * span, m - d);
+            } else if constexpr (Radix == 4) {
+                const Complex t0 = v[0] + v[2];
+                const Complex t1 = v[0] - v[2];
+                const Complex t2 = v[1] + v[3];
+                const Complex t3 = rotateQuarter(v[1] - v[3], sign);
+                store(dst, base, t0 + t2);
+                store(dst, base + span, t1 + t3);
+                store(dst, base + 2 * span, t0 - t2);
+                store(dst, base + 3 * span, t1 - t3);
+            } else if constexpr (Radix == 5) {
+                constexpr float cos72 = 0.309016994374947424102293F;
+                constexpr float cos144 = -0.809016994374947424102293F;
+                constexpr float sin72 = 0.951056516295153572116439F;
+                constexpr float sin144 = 0.587785252292473129168706F;
+                const Complex t1 = v[1] + v[4];
+                const Complex t2 = v[2] + v[3];
+                const Complex d1 = rotateQuarter(v[1] - v[4], sign);
+                const Complex d2 = rotateQuarter(v[2] - v[3], sign);
+                const Complex m1 = v[0] + t1 * cos72 + t2 * cos144;
+                const Complex m2 = v[0] + t1 * cos144 + t2 * cos72;
+                const Complex s1 = d1 * sin72 + d2 * sin144;
+                const Complex s2 = d1 * sin144 - d2 * sin72;
+                store(dst, base, v[0] + t1 + t2);
+                store(dst, base + span, m1 + s1);
+                store(dst, base + 2 * span, m2 + s2);
+                store(dst, base + 3 * span, m2 - s2);
+                store(dst, base + 4 * span, m1 - s1);
+            }
+        }
+    }
+}
+
+void genericStage(const float* src,
+                  float* dst,
+                  size_t n,
+                  size_t radix,
+                  size_t span,
+                  const std::vector<float>& twiddles,
+                  const std::vector<float>& roots) {
+    const size_t stride = n / radix;
+    const size_t groups = stride / span;
+    std::array<Complex, maxRadix> v;
+    for (size_t g = 0; g < groups; g++) {
+        for (size_t k = 0; k < span; k++) {
+            const float* tw = &twiddles[2 * k * (radix - 1)];
+            v[0] = load(src, g * span + k);
+            for (size_t q = 1; q < radix; q++) {
+                v[q] = load(src, g * span + k + q * stride) * Complex{tw[2 * (q - 1)], tw[2 * (q - 1) + 1]};
+            }
+            for (size_t r = 0; r < radix; r++) {
+                Complex sum = v[0];
+                for (size_t q = 1, idx = r; q < radix; q++, idx = (idx + r) % radix) {
+                    sum = sum + v[q] * Complex{roots[2 * idx], roots[2 * idx + 1]};
+                }
+                store(dst, g * span * radix + k + r * span, sum);
+            }
+        }
+    }
+}
+
+struct FFTPlanKey {
+    size_t n;
+    bool inverse;
+
+    [[nodiscard]] size_t hash() const {
+        return (n << 1) | static_cast<size_t>(inverse);
+    }
+
+    bool operator==(const FFTPlanKey& rhs) const {
+        return n == rhs.n && inverse == rhs.inverse;
+    }
+};
+
+}  // namespace
+
+FFTPlan::FFTPlan(size_t n, bool inverse) : m_size(n), m_inverse(inverse) {
+    OPENVINO_ASSERT(n > 0, "FFT length must be positive");
+    const double sign = inverse ? 1.0 : -1.0;
+    const auto radices = factorize(n);
+
+    if (!radices.empty() || n == 1) {
+        size_t span = 1;
+        for (const auto radix : radices) {
+            Stage stage{radix, span, {}, {}};
+            stage.twiddles.reserve(2 * span * (radix - 1));
+            for (size_t k = 0; k < span; k++) {
+                for (size_t q = 1; q < radix; q++) {
+                    pushRoot(stage.twiddles, sign * 2.0 * PI * static_cast<double>(k * q) / (span * radix));
+                }
+            }
+            if (radix > 5) {
+                for (size_t t = 0; t < radix; t++) {
+                    pushRoot(stage.roots, sign * 2.0 * PI * static_cast<double>(t) / radix);
+                }
+            }
+            m_stages.push_back(std::move(stage));
+            span *= radix;
+        }
+        m_scratchSize = 2 * n;
+        return;
+    }
+
+    // Bluestein: X[k] = c[k] * sum(x[j] * c[j] * conj(c[k - j])) with the chirp c[j] = exp(sign * i * pi * j^2 / n),
+    // the sum is a convolution computed by the power of two FFT
+    size_t m = 1;
+    while (m < 2 * n - 1) {
+        m <<= 1;
+    }
+    m_convolutionPlan = std::make_shared<FFTPlan>(m, false);
+
+    m_chirp.reserve(2 * n);
+    for (size_t j = 0; j < n; j++) {
+        const auto jj = static_cast<uint64_t>(j) * j % (2 * static_cast<uint64_t>(n));
+        pushRoot(m_chirp, sign * PI * static_cast<double>(jj) / n);
+    }
+
+    m_filterSpectrum.assign(2 * m, 0.0F);
+    for (size_t j = 0; j < n; j++) {
+        const Complex conjChirp{m_chirp[2 * j], -m_chirp[2 * j + 1]};
+        store(m_filterSpectrum.data(), j, conjChirp);
+        if (j != 0) {
+            store(m_filterSpectrum.data(), m - j, conjChirp);
+        }
+    }
+    std::vector<float> scratch(m_convolutionPlan->getScratchSize());
+    m_convolutionPlan->execute(m_filterSpectrum.data(), scratch.data());
+    // fold the normalization of the inverse convolution FFT into the filter
+    const float reciprocalM = 1.0F / static_cast<float>(m);
+    for (auto& value : m_filterSpectrum) {
+        value *= reciprocalM;
+    }
+
+    m_scratchSize = 2 * m + m_convolutionPlan->getScratchSize();
+}
+
+void FFTPlan::execute(float* data, float* scratch) const {
+    if (m_convolutionPlan) {
+        executeBluestein(data, scratch);
+    } else {
+        executeMixedRadix(data, scratch);
+    }
+
+    if (m_inverse) {
+        const float reciprocalN = 1.0F / static_cast<float>(m_size);
+        for (size_t i = 0; i < 2 * m_size; i++) {
+            data[i] *= reciprocalN;
+        }
+    }
+}
+
+void FFTPlan::executeMixedRadix(float* data, float* scratch) const {
+    float* src = data;
+    float* dst = scratch;
+    for (const auto& stage : m_stages) {
+        executeStage(stage, src, dst);
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        cpu_memcpy(data, src, 2 * m_size * sizeof(float));
+    }
+}
+
+void FFTPlan::executeStage(const Stage& stage, const float* src, float* dst) const {
+    const float sign = m_inverse ? 1.0F : -1.0F;
+    switch (stage.radix) {
+    case 2:
+        radixStage<2>(src, dst, m_size, stage.span, stage.twiddles, sign);
+        break;
+    case 3:
+        radixStage<3>(src, dst, m_size, stage.span, stage.twiddles, sign);
+        break;
+    case 4:
+        radixStage<4>(src, dst, m_size, stage.span, stage.twiddles, sign);
+        break;
+    case 5:
+        radixStage<5>(src, dst, m_size, stage.span, stage.twiddles, sign);
+        break;
+    default:
+        genericStage(src, dst, m_size, stage.radix, stage.span, stage.twiddles, stage.roots);
+        break;
+    }
+}
+
+void FFTPlan::executeBluestein(float* data, float* scratch) const {
+    const size_t m = m_convolutionPlan->size();
+    float* conv = scratch;
+    float* convScratch = scratch + 2 * m;
+
+    for (size_t j = 0; j < m_size; j++) {
+        store(conv, j, load(data, j) * load(m_chirp.data(), j));
+    }
+    std::fill(conv + 2 * m_size, conv + 2 * m, 0.0F);
+    m_convolutionPlan->execute(conv, convScratch);
+
+    // the inverse FFT is computed by the forward one as conj(FFT(conj(x)))
+    for (size_t k = 0; k < m; k++) {
+        const Complex value = load(conv, k) * load(m_filterSpectrum.data(), k);
+        store(conv, k, {value.re, -value.im});
+    }
+    m_convolutionPlan->execute(conv, convScratch);
+
+    for (size_t k = 0; k < m_size; k++) {
+        const Complex value = load(conv, k);
+        store(data, k, Complex{value.re, -value.im} * load(m_chirp.data(), k));
+    }
+}
+
+std::shared_ptr<const FFTPlan> FFTPlan::get(size_t n, bool inverse) {
+    static std::mutex mutex;
+    static LruCache<FFTPlanKey, std::shared_ptr<const FFTPlan>> cache(planCacheCapacity);
+
+    const FFTPlanKey key{n, inverse};
+    std::lock_guard<std::mutex> lock(mutex);
+    auto plan = cache.get(key);
+    if (!plan) {
+        plan = std::make_shared<const FFTPlan>(n, inverse);
+        cache.put(key, plan);
+    }
+    return plan;
+}
+
+bool FFTPlan::isBeneficial(size_t n) {
+    if (isPowerOfTwo(n)) {
+        return false;
+    }
+    // Bluestein runs three power of two FFTs of at least twice the length, so it pays off on longer signals only
+    return factorize(n).empty() ? n >= 64 : n >= 8;
+}
+
+}  // namespace ov::intel_cpu
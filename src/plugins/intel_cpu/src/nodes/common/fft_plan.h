@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * Precomputed complex FFT of an arbitrary length shared by the DFT family nodes (DFT, RDFT, STFT, ISTFT).
+ * Lengths which factorize into small radices (4, 2, 3, 5, 7, 11, 13) are computed by the mixed radix Stockham
+ * algorithm, the other lengths are reduced to a power of two convolution by the Bluestein algorithm, so both are
+ * O(n log n) instead of the O(n^2) naive DFT.
+ * The data is interleaved complex float values, the inverse transform is normalized by 1/n.
+ */
+class FFTPlan {
+public:
+    FFTPlan(size_t n, bool inverse);
+
+    /**
+     * Computes the transform of size() complex values in place.
+     * @param data interleaved complex values, 2 * size() floats
+     * @param scratch working buffer of getScratchSize() floats
+     */
+    void execute(float* data, float* scratch) const;
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    [[nodiscard]] size_t getScratchSize() const {
+        return m_scratchSize;
+    }
+
+    /**
+     * Returns the plan for the given length and direction from the process wide cache, creating it if needed.
+     */
+    static std::shared_ptr<const FFTPlan> get(size_t n, bool inverse);
+
+    /**
+     * Checks whether the plan outperforms the naive DFT for the given length. Power of two lengths are expected to
+     * be served by the dedicated radix-2 FFT implementations, very short signals by the naive DFT kernels.
+     */
+    static bool isBeneficial(size_t n);
+
+private:
+    struct Stage {
+        size_t radix;
+        size_t span;                  // length of the sub-transforms already merged before the stage
+        std::vector<float> twiddles;  // span x (radix - 1) complex values
+        std::vector<float> roots;     // radix complex roots of unity for the generic butterfly
+    };
+
+    void executeMixedRadix(float* data, float* scratch) const;
+    void executeBluestein(float* data, float* scratch) const;
+    void executeStage(const Stage& stage, const float* src, float* dst) const;
+
+    size_t m_size;
+    bool m_inverse;
+    size_t m_scratchSize = 0;
+
+    std::vector<Stage> m_stages;
+
+    // Bluestein state: the chirp, the spectrum of the chirp filter and the power of two convolution plan
+    std::vector<float> m_chirp;
+    std::vector<float> m_filterSpectrum;
+    std::shared_ptr<const FFTPlan> m_convolutionPlan;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+namespace {
+// the first block covers the typical number of boxes selected per class
+constexpr size_t MIN_CANDIDATES_BLOCK = 64;
+// number of the selected boxes processed by a single vectorized IoU pass before the early exit check
+constexpr size_t SELECTED_BOXES_BLOCK = 64;
+
+bool isBetter(const NmsCandidates::Candidate& l, const NmsCandidates::Candidate& r) {
+    return l.first > r.first || (l.first == r.first && l.second < r.second);
+}
+}  // namespace
+
+void NmsCandidates::collect(const float* scores,
+                            size_t num,
+                            float threshold,
+                            bool inclusive,
+                            size_t limit,
+                            size_t blockSize) {
+    // branchless compaction, every box is written and the output position advances only for the passed ones
+    m_candidates.resize(num);
+    size_t count = 0;
+    if (inclusive) {
+        for (size_t i = 0; i < num; i++) {
+            m_candidates[count] = {scores[i], static_cast<int>(i)};
+            count += static_cast<size_t>(scores[i] >= threshold);
+        }
+    } else {
+        for (size_t i = 0; i < num; i++) {
+            m_candidates[count] = {scores[i], static_cast<int>(i)};
+            count += static_cast<size_t>(scores[i] > threshold);
+        }
+    }
+    m_candidates.resize(count);
+    m_size = std::min(count, limit);
+    m_sorted = 0;
+    m_blockSize = std::max(blockSize, MIN_CANDIDATES_BLOCK);
+}
+
+void NmsCandidates::sortUpTo(size_t end) {
+    const size_t blockEnd = std::min(std::max(end, m_sorted + m_blockSize), m_size);
+    const auto first = m_candidates.begin() + m_sorted;
+    const auto nth = m_candidates.begin() + blockEnd;
+    if (nth != m_candidates.end()) {
+        // move the best candidates of the block in front of the rest ones
+        std::nth_element(first, nth, m_candidates.end(), isBetter);
+    }
+    std::sort(first, nth, isBetter);
+    m_sorted = blockEnd;
+    m_blockSize *= 2;
+}
+
+NmsSelectedBoxes::NmsSelectedBoxes(size_t capacity, float norm)
+    : m_norm(norm),
+      m_ymin(capacity),
+      m_xmin(capacity),
+      m_ymax(capacity),
+      m_xmax(capacity),
+      m_area(capacity) {}
+
+void NmsSelectedBoxes::push(float ymin, float xmin, float ymax, float xmax) {
+    m_ymin[m_size] = ymin;
+    m_xmin[m_size] = xmin;
+    m_ymax[m_size] = ymax;
+    m_xmax[m_size] = xmax;
+    m_area[m_size] = (ymax - ymin + m_norm) * (xmax - xmin + m_norm);
+    m_size++;
+}
+
+bool NmsSelectedBoxes::suppresses(float ymin, float xmin, float ymax, float xmax, float iouThreshold) const {
+    const float area = (ymax - ymin + m_norm) * (xmax - xmin + m_norm);
+    if (area <= 0.F) {
+        // IoU of a degenerated box with any box is 0, it is still compared with the threshold
+        return m_size > 0 && 0.F >= iouThreshold;
+    }
+    const float* selYmin = m_ymin.data();
+    const float* selXmin = m_xmin.data();
+    const float* selYmax = m_ymax.data();
+    const float* selXmax = m_xmax.data();
+    const float* selArea = m_area.data();
+    for (size_t start = 0; start < m_size; start += SELECTED_BOXES_BLOCK) {
+        const size_t end = std::min(start + SELECTED_BOXES_BLOCK, m_size);
+        int suppressed = 0;
+        for (size_t j = start; j < end; j++) {
+            const float intersection = std::max(std::min(ymax, selYmax[j]) - std::max(ymin, selYmin[j]) + m_norm, 0.F) *
+                                       std::max(std::min(xmax, selXmax[j]) - std::max(xmin, selXmin[j]) + m_norm, 0.F);
+            const float iou = selArea[j] > 0.F ? intersection / (area + selArea[j] - intersection) : 0.F;
+            suppressed |= static_cast<int>(iou >= iouThreshold);
+        }
+        if (suppressed != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * Candidate boxes of a single class ordered by the descending score, the ties are ordered by the ascending box index.
+ * The NMS nodes consume only a few of the best candidates in most of the cases: the greedy suppression stops as soon
+ * as the requested number of boxes is selected and nms_top_k bounds the number of candidates explicitly. So the
+ * candidates are not sorted all at once: the next block of the best candidates is selected by nth_element and only
+ * this block is sorted when the consumer reaches it, the block size grows geometrically.
+ */
+class NmsCandidates {
+public:
+    using Candidate = std::pair<float, int>;  // score, box index
+
+    /**
+     * Collects the boxes which pass the score threshold.
+     * @param inclusive whether the boxes with the score equal to the threshold pass
+     * @param limit maximum number of the candidates to consume, i.e. nms_top_k
+     * @param blockSize number of the candidates sorted at once first, i.e. the expected number of the consumed ones
+     */
+    void collect(const float* scores,
+                 size_t num,
+                 float threshold,
+                 bool inclusive,
+                 size_t limit = static_cast<size_t>(-1),
+                 size_t blockSize = 0);
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return m_size == 0;
+    }
+
+    /**
+     * Returns the i-th best candidate, i < size()
+     */
+    const Candidate& operator[](size_t i) {
+        if (i >= m_sorted) {
+            sortUpTo(i + 1);
+        }
+        return m_candidates[i];
+    }
+
+private:
+    void sortUpTo(size_t end);
+
+    std::vector<Candidate> m_candidates;
+    size_t m_size = 0;
+    size_t m_sorted = 0;
+    size_t m_blockSize = 0;
+};
+
+/**
+ * Boxes selected by the greedy NMS stored as the structure of arrays of the corner coordinates and the areas, so the
+ * IoU of a candidate with all the selected boxes is computed by a vectorized loop over the blocks of the selected
+ * boxes instead of a box by box scalar loop. The IoU matches the scalar one of the NMS nodes bit by bit.
+ */
+class NmsSelectedBoxes {
+public:
+    /**
+     * @param norm 1 if the box coordinates are not normalized and the width and height are inclusive, 0 otherwise
+     */
+    explicit NmsSelectedBoxes(size_t capacity, float norm = 0.F);
+
+    void push(float ymin, float xmin, float ymax, float xmax);
+
+    /**
+     * Checks whether IoU of the box with any of the selected boxes is greater than or equal to the threshold
+     */
+    [[nodiscard]] bool suppresses(float ymin, float xmin, float ymax, float xmax, float iouThreshold) const;
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+private:
+    float m_norm;
+    size_t m_size = 0;
+    std::vector<float> m_ymin;
+    std::vector<float> m_xmin;
+    std::vector<float> m_ymax;
+    std::vector<float> m_xmax;
+    std::vector<float> m_area;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,250 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "unique_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+// a smaller input is grouped by a single table, the partitioning does not pay off for it
+constexpr size_t PARTITIONING_THRESHOLD = 1LU << 16;
+// the partition of an element is stored in a byte
+constexpr size_t MAX_PARTITIONS_LOG2 = 8;
+constexpr int32_t EMPTY_SLOT = -1;
+
+template <typename T>
+uint64_t hashValue(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        // +0.0 and -0.0 are equal
+        if (value == T(0)) {
+            value = T(0);
+        }
+    }
+    uint64_t x = 0;
+    std::memcpy(&x, &value, sizeof(T));
+    // splitmix64 finalizer: every bit of the hash depends on every bit of the value, so the high bits select the
+    // partition and the low bits select the slot of the table independently
+    x ^= x >> 30U;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27U;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31U;
+    return x;
+}
+
+/**
+ * Open addressing table of the groups with the linear probing. The elements must be inserted in the ascending index
+ * order, so the groups are numbered in the order of their first occurrences.
+ */
+template <typename T>
+class GroupTable {
+public:
+    explicit GroupTable(size_t maxGroups) {
+        size_t capacity = 16;
+        while (capacity < 2 * maxGroups) {
+            capacity <<= 1;
+        }
+        m_slots.assign(capacity, EMPTY_SLOT);
+        m_mask = capacity - 1;
+    }
+
+    int32_t insert(T value, size_t index) {
+        for (size_t slot = hashValue(value) & m_mask;; slot = (slot + 1) & m_mask) {
+            const int32_t group = m_slots[slot];
+            if (group == EMPTY_SLOT) {
+                const auto newGroup = static_cast<int32_t>(m_values.size());
+                m_slots[slot] = newGroup;
+                m_values.push_back(value);
+                firsts.push_back(static_cast<int32_t>(index));
+                counts.push_back(1);
+                return newGroup;
+            }
+            if (m_values[group] == value) {
+                counts[group]++;
+                return group;
+            }
+        }
+    }
+
+    std::vector<int32_t> firsts;
+    std::vector<int32_t> counts;
+
+private:
+    std::vector<int32_t> m_slots;
+    std::vector<T> m_values;
+    size_t m_mask = 0;
+};
+}  // namespace
+
+template <typename T>
+size_t groupUniqueElements(const T* src,
+                           size_t len,
+                           int32_t* groupOf,
+                           std::vector<int32_t>& firsts,
+                           std::vector<int32_t>& counts) {
+    const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (len < PARTITIONING_THRESHOLD || nthr == 1) {
+        GroupTable<T> table(len);
+        for (size_t i = 0; i < len; i++) {
+            groupOf[i] = table.insert(src[i], i);
+        }
+        firsts = std::move(table.firsts);
+        counts = std::move(table.counts);
+        return firsts.size();
+    }
+
+    size_t partitionsLog2 = 1;
+    while ((1LU << partitionsLog2) < 4 * nthr && partitionsLog2 < MAX_PARTITIONS_LOG2) {
+        partitionsLog2++;
+    }
+    const size_t partitions = 1LU << partitionsLog2;
+
+    // histogram of the partitions per chunk of the input
+    std::vector<uint8_t> partitionOf(len);
+    std::vector<size_t> offsets(nthr * partitions, 0);
+    parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, nthr, ithr, start, end);
+        auto* histogram = offsets.data() + ithr * partitions;
+        for (size_t i = start; i < end; i++) {
+            const auto partition = static_cast<uint8_t>(hashValue(src[i]) >> (64 - partitionsLog2));
+            partitionOf[i] = partition;
+            histogram[partition]++;
+        }
+    });
+
+    // the chunks are placed one after another inside a partition, so its elements stay in the ascending index order
+    std::vector<size_t> partitionBegin(partitions + 1);
+    size_t total = 0;
+    for (size_t p = 0; p < partitions; p++) {
+        partitionBegin[p] = total;
+        for (size_t ithr = 0; ithr < nthr; ithr++) {
+            const size_t count = offsets[ithr * partitions + p];
+            offsets[ithr * partitions + p] = total;
+            total += count;
+        }
+    }
+    partitionBegin[partitions] = total;
+
+    std::vector<int32_t> order(len);
+    parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, nthr, ithr, start, end);
+        auto* offset = offsets.data() + ithr * partitions;
+        for (size_t i = start; i < end; i++) {
+            order[offset[partitionOf[i]]++] = static_cast<int32_t>(i);
+        }
+    });
+
+    // the groups local to the partitions
+    std::vector<std::vector<int32_t>> partitionFirsts(partitions);
+    std::vector<std::vector<int32_t>> partitionCounts(partitions);
+    parallel_for(partitions, [&](size_t p) {
+        GroupTable<T> table(partitionBegin[p + 1] - partitionBegin[p]);
+        for (size_t k = partitionBegin[p]; k < partitionBegin[p + 1]; k++) {
+            const auto i = static_cast<size_t>(order[k]);
+            groupOf[i] = table.insert(src[i], i);
+        }
+        partitionFirsts[p] = std::move(table.firsts);
+        partitionCounts[p] = std::move(table.counts);
+    });
+
+    std::vector<size_t> groupBase(partitions + 1);
+    groupBase[0] = 0;
+    for (size_t p = 0; p < partitions; p++) {
+        groupBase[p + 1] = groupBase[p] + partitionFirsts[p].size();
+    }
+    const size_t groupsNum = groupBase[partitions];
+
+    // the global number of a group is the number of the first occurrences before its own one
+    std::vector<uint8_t> isFirst(len, 0);
+    parallel_for(partitions, [&](size_t p) {
+        for (const auto first : partitionFirsts[p]) {
+            isFirst[first] = 1;
+        }
+    });
+    std::vector<size_t> chunkBase(nthr + 1, 0);
+    parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, nthr, ithr, start, end);
+        size_t count = 0;
+        for (size_t i = start; i < end; i++) {
+            count += isFirst[i];
+        }
+        chunkBase[ithr + 1] = count;
+    });
+    for (size_t ithr = 0; ithr < nthr; ithr++) {
+        chunkBase[ithr + 1] += chunkBase[ithr];
+    }
+    // the order is not needed anymore, it keeps the global number of a group at the index of its first occurrence
+    parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, nthr, ithr, start, end);
+        auto group = static_cast<int32_t>(chunkBase[ithr]);
+        for (size_t i = start; i < end; i++) {
+            if (isFirst[i]) {
+                order[i] = group++;
+            }
+        }
+    });
+
+    firsts.resize(groupsNum);
+    counts.resize(groupsNum);
+    std::vector<int32_t> globalGroup(groupsNum);
+    parallel_for(partitions, [&](size_t p) {
+        for (size_t local = 0; local < partitionFirsts[p].size(); local++) {
+            const auto first = partitionFirsts[p][local];
+            const auto group = order[first];
+            globalGroup[groupBase[p] + local] = group;
+            firsts[group] = first;
+            counts[group] = partitionCounts[p][local];
+        }
+    });
+    parallel_for(nthr, [&](size_t ithr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, nthr, ithr, start, end);
+        for (size_t i = start; i < end; i++) {
+            groupOf[i] = globalGroup[groupBase[partitionOf[i]] + groupOf[i]];
+        }
+    });
+
+    return groupsNum;
+}
+
+template size_t groupUniqueElements<float>(const float*,
+                                           size_t,
+                                           int32_t*,
+                                           std::vector<int32_t>&,
+                                           std::vector<int32_t>&);
+template size_t groupUniqueElements<int32_t>(const int32_t*,
+                                             size_t,
+                                             int32_t*,
+                                             std::vector<int32_t>&,
+                                             std::vector<int32_t>&);
+template size_t groupUniqueElements<int8_t>(const int8_t*,
+                                            size_t,
+                                            int32_t*,
+                                            std::vector<int32_t>&,
+                                            std::vector<int32_t>&);
+template size_t groupUniqueElements<uint8_t>(const uint8_t*,
+                                             size_t,
+                                             int32_t*,
+                                             std::vector<int32_t>&,
+                                             std::vector<int32_t>&);
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * Groups the equal elements of a flat tensor with hash tables instead of sorting the whole tensor.
+ * The groups are numbered in the order of their first occurrences. Every element gets the number of its group, and
+ * the index of the first occurrence and the number of the elements of every group are returned.
+ * A large input is radix partitioned by the hash first. The partitions are grouped in parallel, each one by its own
+ * open addressing table, and the groups of the partitions are then renumbered to the global first occurrence order.
+ * NaN is not equal to anything, so every NaN element forms its own group, like in the reference implementation.
+ *
+ * @param groupOf output, the number of the group of every element
+ * @param firsts output, the index of the first element of every group
+ * @param counts output, the number of the elements of every group
+ * @return the number of the groups, i.e. the number of the unique elements
+ */
+template <typename T>
+size_t groupUniqueElements(const T* src,
+                           size_t len,
+                           int32_t* groupOf,
+                           std::vector<int32_t>& firsts,
+                           std::vector<int32_t>& counts);
+
+}  // namespace ov::intel_cpu
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/fft_plan.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
@@ -269,6 +270,9 @@ void DFT::execute([[maybe_unused]] const dnnl::stream& strm) {
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
         // FFT uses different twiddle factors
+        if (FFTPlan::isBeneficial(nComplex)) {
+            continue;
+        }
         if (!IsPowerOfTwo(nComplex)) {
             if (twiddlesMapDFT.find(nComplex) == twiddlesMapDFT.end() || lastInverse != inverse) {
                 twiddlesMapDFT[nComplex] = generateTwiddlesDFT(nComplex, inverse);
@@ -304,6 +308,10 @@ void DFT::execute([[maybe_unused]] const dnnl::stream& strm) {
             if (resultBufPtr != dst) {
                 cpu_memcpy(dst, resultBufPtr, nComplex * 2 * sizeof(float));
             }
+        } else if (FFTPlan::isBeneficial(nComplex)) {
+            const auto plan = FFTPlan::get(nComplex, inverse);
+            std::vector<float> scratch(plan->getScratchSize());
+            plan->execute(dst, scratch.data());
         } else {
             naiveDFT(dst, nComplex * 2, inverse);
         }
@@ -327,11 +335,13 @@ void DFT::dftNd(float* output,
         const size_t outputLen = outputComplexLen * 2;
 
         std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
+        const auto plan = FFTPlan::isBeneficial(outputComplexLen) ? FFTPlan::get(outputComplexLen, inverse) : nullptr;
+        if (IsPowerOfTwo(outputComplexLen) || plan) {
             size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+            const size_t bufferLen = plan ? outputLen + plan->getScratchSize() : outputLen * 2;
             do {
                 cpu_parallel->parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen * 2);
+                    std::vector<float> gatheredData(bufferLen);
                     auto parallelIterationCounter = iterationCounter;
                     parallelIterationCounter[parallelDimIndex] = dim;
                     gatherToBufferND(gatheredData.data(),
@@ -340,8 +350,17 @@ void DFT::dftNd(float* output,
                                      parallelIterationCounter,
                                      outputShape,
                                      outputStrides);
-                    const float* resultBufPtr = nullptr;
-                    fft(gatheredData.data(), gatheredData.data() + outputLen, outputLen, inverse, false, &resultBufPtr);
+                    const float* resultBufPtr = gatheredData.data();
+                    if (plan) {
+                        plan->execute(gatheredData.data(), gatheredData.data() + outputLen);
+                    } else {
+                        fft(gatheredData.data(),
+                            gatheredData.data() + outputLen,
+                            outputLen,
+                            inverse,
+                            false,
+                            &resultBufPtr);
+                    }
                     applyBufferND(resultBufPtr,
                                   output,
                                   currentAxis,
@@ -631,7 +650,7 @@ void DFT::createPrimitive() {
         for (auto axis : axes) {
             if (IsPowerOfTwo(outputShape[axis])) {
                 hasFFT = true;
-            } else {
+            } else if (!FFTPlan::isBeneficial(outputShape[axis])) {
                 hasDFT = true;
             }
         }
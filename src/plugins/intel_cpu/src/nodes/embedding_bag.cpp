@@ -4,6 +4,7 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -12,6 +13,7 @@
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "nodes/kernels/embedding_bag.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
@@ -130,17 +132,73 @@ void EmbeddingBag::processData(const T* srcData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBag::processFloatData(const uint8_t* srcData,
+                                    const float* weightsData,
+                                    const ov::element::Type& srcPrc,
+                                    const VectorDims& inDataDims,
+                                    const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto* dstData = outMemory->getDataAs<float>();
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0LU);
+        size_t end(0LU);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+
+        size_t indicesSize = 0LU;
+        const int* indices = nullptr;
+        int weightsIdx = 0LU;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::fill_n(dst, _embDepth, 0.F);
+                continue;
+            }
+            withWeights = withWeights & _withWeights;
+
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
+                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
+                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+            }
+            // the repeated indices of a bag are not merged: their rows are served from the cache after the first
+            // access, while merging would change the order of the accumulation
+            ov::Extensions::Cpu::XARCH::embedding_bag_reduce(
+                dst,
+                srcData,
+                srcPrc,
+                _embDepth,
+                indices,
+                indicesSize,
+                withWeights ? weightsData + weightsIdx : nullptr,
+                _reduction == Reduction::MEAN ? static_cast<float>(indicesSize) : 1.F);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBag::execute(const uint8_t* srcData,
                            const uint8_t* weightsData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
     switch (srcPrc) {
-    case ov::element::f32: {
-        processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                                                                       reinterpret_cast<const float*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
+    case ov::element::f32:
+    case ov::element::bf16:
+    case ov::element::f16: {
+        // the per sample weights and the output are f32 for any of the floating point tables
+        processFloatData(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
         break;
     }
     case ov::element::i8: {
@@ -45,6 +45,12 @@ protected:
 
     template <typename T>
     void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    // f32, bf16 and f16 tables accumulated in f32 by the vectorized kernel
+    void processFloatData(const uint8_t* srcData,
+                          const float* weightsData,
+                          const ov::element::Type& srcPrc,
+                          const VectorDims& inDataDims,
+                          const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
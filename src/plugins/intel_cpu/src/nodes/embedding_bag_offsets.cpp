@@ -86,6 +86,8 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
                                                                     ov::element::i32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // bf16 and f16 tables are read as is and accumulated in f32, so a huge table is neither converted nor copied
+    const auto tablePrecision = inDataPrecision;
     if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
         inDataPrecision = ov::element::f32;
     }
@@ -103,7 +105,7 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX) {
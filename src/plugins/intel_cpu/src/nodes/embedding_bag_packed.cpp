@@ -84,6 +84,8 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
                                                                     ov::element::i32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // bf16 and f16 tables are read as is and accumulated in f32, so a huge table is neither converted nor copied
+    const auto tablePrecision = inDataPrecision;
     if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
         inDataPrecision = ov::element::f32;
     }
@@ -102,7 +104,7 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
     }
 
     std::vector<PortConfigurator> inDataConfigurators(
-        {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
+        {{LayoutType::ncsp, tablePrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
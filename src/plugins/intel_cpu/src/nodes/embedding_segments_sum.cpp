@@ -71,6 +71,8 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                                                                     ov::element::i32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // bf16 and f16 tables are read as is and accumulated in f32, so a huge table is neither converted nor copied
+    const auto tablePrecision = inDataPrecision;
     if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
         inDataPrecision = ov::element::f32;
     }
@@ -88,7 +90,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                         inDataPrecision.get_type_name());
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
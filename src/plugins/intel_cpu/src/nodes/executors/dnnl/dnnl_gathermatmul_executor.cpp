@@ -16,6 +16,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -28,6 +29,7 @@
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "expert_cache.hpp"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -36,6 +38,7 @@
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/gathermatmul_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
+#include "nodes/reorder.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -356,10 +359,6 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
 
     auto src_precision = srcMemory->getDesc().getPrecision();
     auto weights_precision = weightsMemory->getDesc().getPrecision();
-#ifdef OPENVINO_ARCH_X86_64
-    m_bf16AmxMode =
-        (src_precision == ov::element::bf16 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx));
-#endif
 
     const auto& weiDims = weightsMemory->getShape().getStaticDims();
     const dnnl::memory::dim N = weiDims[weiDims.size() - 2];
@@ -429,17 +428,32 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
         return MemoryDescUtils::convertToDnnlMemoryDesc(targetDesc);
     };
 
-    auto targetWeightsDesc = addBatchDim(gemvWeightsDesc, weiDims[0]);
-    auto srcWeightsDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightsMemory->getDescPtr());
-
-    m_weightsMemory = utils::prepareWeightsMemory(srcWeightsDesc,
-                                                  targetWeightsDesc,
-                                                  weightsMemory,
-                                                  eng,
-                                                  cache,
-                                                  context->getWeightsCache(),
-                                                  context->getPrivateWeightCache(),
-                                                  threadPool);
+    m_numExperts = weiDims[0];
+    const size_t expertBits = static_cast<size_t>(N) * static_cast<size_t>(K) * weights_precision.bitwidth();
+    m_expertCache = context->getExpertCache();
+    if (m_expertCache && weightsMemory->getDesc().hasLayoutType(LayoutType::ncsp) && expertBits % 8 == 0) {
+        // the experts are packed on first use, so the weights of the cold experts are never touched
+        m_srcWeightsMemory = weightsMemory;
+        m_srcExpertSize = expertBits / 8;
+        const Shape expertShape(VectorDims(weiDims.end() - 2, weiDims.end()));
+        auto srcExpertDesc = std::make_shared<CpuBlockedMemoryDesc>(weights_precision, expertShape);
+        m_srcExpertDesc = MemoryDescUtils::convertToDnnlMemoryDesc(srcExpertDesc);
+        m_expertDesc = MemoryDescUtils::convertToDnnlMemoryDesc(gemvWeightsDesc);
+        m_expertKey = DnnlExtensionUtils::computeWeightsStringHash(weightsMemory, m_expertDesc);
+    } else {
+        m_expertCache.reset();
+        auto targetWeightsDesc = addBatchDim(gemvWeightsDesc, weiDims[0]);
+        auto srcWeightsDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightsMemory->getDescPtr());
+
+        m_weightsMemory = utils::prepareWeightsMemory(srcWeightsDesc,
+                                                      targetWeightsDesc,
+                                                      weightsMemory,
+                                                      eng,
+                                                      cache,
+                                                      context->getWeightsCache(),
+                                                      context->getPrivateWeightCache(),
+                                                      threadPool);
+    }
 
     if (!scale_shape.empty()) {
         auto expectedScaleMemDesc =
@@ -472,15 +486,12 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
 }
 
 bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
-    if (!m_bf16AmxMode) {
-        return true;
-    }
-
     const auto& srcMem = memory.at(ARG_SRC);
     const auto& srcShape = srcMem->getStaticDims();
     // srcShape is [B, M, K]
     if (Dim{1} == srcShape[1]) {
         // If M is 1, we can skip the temporary buffer and execute GEMV in-place on the src buffer
+        m_tmpInpBuffer.reset();
         return true;
     }
     const Dim M = normalizeM(srcShape[1]);
@@ -497,11 +508,21 @@ bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
     const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
     auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
     m_tmpInpBuffer = m_context->getScratchPad()->createScratchPadMem(scratchPadDesc);
+    return true;
+}
 
-    OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
+GatherMatmulDnnlExecutor::InnerProductPtr GatherMatmulDnnlExecutor::getGemmImpl(Dim rows, const MemoryPtr& biasMem) {
+    // GEMM primitives are bucketed by the normalized number of rows routed to an expert, so skewed routing
+    // doesn't pay for the rows of the whole batch and the number of distinct primitives stays small
+    const Dim M = normalizeM(rows);
+    if (auto it = m_gemmImpls.find(M); it != m_gemmImpls.end()) {
+        return it->second;
+    }
 
-    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(srcShape[2])},
-                              DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
+    OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
+    const auto K = m_tmpInputDesc->getShape().getStaticDims()[1];
+    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(K)},
+                              DnnlExtensionUtils::ElementTypeToDataType(m_tmpInputDesc->getPrecision()),
                               dnnl::memory::format_tag::ab);
     auto weights_md = m_gemvImpl->get_weights_md();
 
@@ -526,16 +547,39 @@ bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
 
     InnerProductKey key{src_md,
                         weights_md,
-                        makeBiasMd(static_cast<dnnl::memory::dim>(weights_md.get_dims()[0]), memory.at(ARG_BIAS)),
+                        makeBiasMd(static_cast<dnnl::memory::dim>(weights_md.get_dims()[0]), biasMem),
                         scale_shape,
                         zp_shape};
     const auto& eng = m_context->getEngine();
     const auto threadPool = m_context->getThreadPool();
     auto cache = m_context->getRuntimeCache();
-    std::tie(m_gemmImpl, std::ignore) = cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
-        return std::make_shared<InnerProduct>(eng, threadPool, k);
+    InnerProductPtr gemmImpl;
+    try {
+        std::tie(gemmImpl, std::ignore) = cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
+            return std::make_shared<InnerProduct>(eng, threadPool, k);
+        });
+    } catch (const dnnl::error& e) {
+        if (e.status != dnnl_unimplemented) {
+            throw;
+        }
+        // no GEMM implementation for the packed weights layout, the rows are processed by GEMV one by one
+    }
+    // the reference GEMM is slower than the optimized GEMV applied row by row
+    if (gemmImpl && (gemmImpl->get_impl_type() & impl_desc_type::ref) != 0) {
+        gemmImpl = nullptr;
+    }
+    m_gemmImpls.emplace(M, gemmImpl);
+    return gemmImpl;
+}
+
+MemoryPtr GatherMatmulDnnlExecutor::getExpertWeights(size_t expert) const {
+    return m_expertCache->get(m_expertKey + "_" + std::to_string(expert), [&]() {
+        const auto* srcData = static_cast<const uint8_t*>(m_srcWeightsMemory->getData()) + expert * m_srcExpertSize;
+        Memory srcMemory{m_context->getEngine(), m_srcExpertDesc, srcData};
+        MemoryPtr packed = std::make_shared<Memory>(m_context->getEngine(), m_expertDesc);
+        node::Reorder::reorderData(srcMemory, *packed, m_context->getRuntimeCache(), m_context->getThreadPool());
+        return packed;
     });
-    return true;
 }
 
 void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
@@ -557,9 +601,44 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
     auto zp_offset = OffsetHelper::createOffsetHelper(m_zpMemory);
     auto index_offset = OffsetHelper::createOffsetHelper(indexMem);
 
-    const size_t gather_axis_size = m_weightsMemory->getStaticDims()[0];
+    const size_t gather_axis_size = m_numExperts;
+
+    if (m_expertCache) {
+        std::vector<bool> routed(gather_axis_size, false);
+        for (size_t m = 0; m < M; m++) {
+            const auto* gather_ids = static_cast<const int32_t*>(index_offset(m));
+            for (size_t i = 0; i < indices_size; i++) {
+                const int32_t gather_axis_index = gather_ids[i];
+                OPENVINO_ASSERT(gather_axis_index >= 0 && static_cast<size_t>(gather_axis_index) < gather_axis_size,
+                                "Invalid gather_id ",
+                                gather_axis_index,
+                                " for m ",
+                                m);
+                routed[gather_axis_index] = true;
+            }
+        }
+        // let the OS read ahead the pages of all the routed experts while the first ones are being packed
+        const auto* srcData = static_cast<const uint8_t*>(m_srcWeightsMemory->getData());
+        for (size_t e = 0; e < gather_axis_size; e++) {
+            if (routed[e]) {
+                ExpertCache::prefetch(srcData + e * m_srcExpertSize, m_srcExpertSize);
+            }
+        }
+    }
+    // with expert paging an expert is packed right before it is applied and is held by the caller only meanwhile,
+    // so at most one evicted expert per executing call stays in memory above the budget
+    auto expert_weights = [&](size_t gather_axis_index, MemoryPtr& holder) {
+        if (!m_expertCache) {
+            return wei_offset(gather_axis_index);
+        }
+        holder = getExpertWeights(gather_axis_index);
+        return holder->getData();
+    };
 
     if (M > 1) {
+        OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
+
+        // sort the routed rows by expert, so every expert is applied once to all of its rows
         std::vector<std::pair<int32_t, int32_t>> gather_idx_map(gather_axis_size * M);
         std::vector<int32_t> elements_per_gather_indx(gather_axis_size, 0);
         for (size_t m = 0; m < M; m++) {
@@ -577,78 +656,74 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
             }
         }
 
-        if (m_bf16AmxMode) {
-            OPENVINO_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
-            OPENVINO_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
-            OPENVINO_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
-
-            const auto element_size = m_tmpInputDesc->getPrecision().size();
-            const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
-            const auto M_size = m_tmpInputDesc->getShape().getStaticDims()[0];
-            const auto N_size = dstMem->getStaticDims()[2];
-
+        std::unique_ptr<Memory> tmpInput;
+        std::unique_ptr<Memory> tmpOutput;
+        if (m_tmpInpBuffer) {
             auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
             auto* output_ptr = input_ptr + rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);
+            tmpInput = std::make_unique<Memory>(m_context->getEngine(), m_tmpInputDesc, input_ptr);
+            tmpOutput = std::make_unique<Memory>(m_context->getEngine(), m_tmpOutputDesc, output_ptr);
+        }
 
-            Memory tmpInput(m_context->getEngine(), m_tmpInputDesc, input_ptr);
-            Memory tmpOutput(m_context->getEngine(), m_tmpOutputDesc, output_ptr);
-
-            auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
-            auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
+            if (0 == num_valid_rows) {
+                continue;
+            }
 
-            OPENVINO_ASSERT(m_gemmImpl, "GEMM implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
-                if (0 == num_valid_rows) {
-                    continue;
-                }
+            MemoryPtr expertMemory;
+            auto* wei = expert_weights(gather_axis_index, expertMemory);
+            auto* bias = bias_offset(gather_axis_index);
+            auto* scale = scale_offset(gather_axis_index);
+            auto* zp = zp_offset(gather_axis_index);
 
-                cpu_parallel->parallel_for(M_size, [&](size_t m) {
-                    auto* dst_row = tmp_input_offset(m);
-                    if (m < num_valid_rows) {
-                        const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                        const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                        const auto* src_data = src_offset(batch_index, row_id);
-                        std::memcpy(dst_row, src_data, K_size * element_size);
-                    } else {
-                        std::memset(dst_row, 0, K_size * element_size);
-                    }
-                });
-
-                auto* src = tmp_input_offset.get_base();
-                auto* dst = tmp_dst_offset.get_base();
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                m_gemmImpl->exec(src, dst, wei, bias, scale, zp);
-
-                cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
-                    const auto* src_row = tmp_dst_offset(m);
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* dst_row = dst_offset(batch_index, row_id);
-                    std::memcpy(dst_row, src_row, N_size * element_size);
-                });
+            // an expert with a single routed row is applied in-place, the others are batched into one GEMM
+            InnerProductPtr gemmImpl;
+            if (num_valid_rows > 1 && tmpInput &&
+                normalizeM(num_valid_rows) <= m_tmpInputDesc->getShape().getStaticDims()[0]) {
+                gemmImpl = getGemmImpl(num_valid_rows, biasMem);
             }
-        } else {
-            OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                if (0 == elements_per_gather_indx[gather_axis_index]) {
-                    continue;
-                }
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
+
+            if (!gemmImpl) {
+                for (size_t m = 0; m < num_valid_rows; ++m) {
                     const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
                     const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
                     auto* src = src_offset(batch_index, row_id);
                     auto* dst = dst_offset(batch_index, row_id);
                     m_gemvImpl->exec(src, dst, wei, bias, scale, zp);
                 }
+                continue;
             }
+
+            const auto element_size = m_tmpInputDesc->getPrecision().size();
+            const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
+            const auto M_size = normalizeM(num_valid_rows);
+            const auto N_size = dstMem->getStaticDims()[2];
+
+            auto tmp_input_offset = OffsetHelper::createOffsetHelper(*tmpInput);
+            auto tmp_dst_offset = OffsetHelper::createOffsetHelper(*tmpOutput);
+
+            cpu_parallel->parallel_for(M_size, [&](size_t m) {
+                auto* dst_row = tmp_input_offset(m);
+                if (m < num_valid_rows) {
+                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
+                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
+                    const auto* src_data = src_offset(batch_index, row_id);
+                    std::memcpy(dst_row, src_data, K_size * element_size);
+                } else {
+                    std::memset(dst_row, 0, K_size * element_size);
+                }
+            });
+
+            gemmImpl->exec(tmp_input_offset.get_base(), tmp_dst_offset.get_base(), wei, bias, scale, zp);
+
+            cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
+                const auto* src_row = tmp_dst_offset(m);
+                const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
+                const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
+                auto* dst_row = dst_offset(batch_index, row_id);
+                std::memcpy(dst_row, src_row, N_size * element_size);
+            });
         }
     } else {
         OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
@@ -664,7 +739,8 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
                             i);
             auto* src = src_offset(i, m);
             auto* dst = dst_offset(i, m);
-            auto* wei = wei_offset(gather_axis_index);
+            MemoryPtr expertMemory;
+            auto* wei = expert_weights(gather_axis_index, expertMemory);
             auto* bias = bias_offset(gather_axis_index);
             auto* scale = scale_offset(gather_axis_index);
             auto* zp = zp_offset(gather_axis_index);
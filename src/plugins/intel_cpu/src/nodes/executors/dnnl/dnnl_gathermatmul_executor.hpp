@@ -6,9 +6,14 @@
 
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <string>
+#include <unordered_map>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
+#include "expert_cache.hpp"
 #include "memory_desc/cpu_memory_desc.h"
+#include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/gathermatmul_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
@@ -32,20 +37,31 @@ private:
     class InnerProduct;
     using InnerProductPtr = std::shared_ptr<InnerProduct>;
 
+    InnerProductPtr getGemmImpl(Dim rows, const MemoryPtr& biasMem);
+    MemoryPtr getExpertWeights(size_t expert) const;
+
     ExecutorContext::CPtr m_context;
 
     MemoryPtr m_weightsMemory;
+    size_t m_numExperts = 0;
+
+    // expert paging: the experts are packed on demand from the original weights through the expert cache
+    ExpertCache::Ptr m_expertCache;
+    MemoryCPtr m_srcWeightsMemory;
+    DnnlMemoryDescPtr m_srcExpertDesc;
+    DnnlMemoryDescPtr m_expertDesc;
+    size_t m_srcExpertSize = 0;  // bytes
+    std::string m_expertKey;
     MemoryPtr m_scalesMemory;
     MemoryPtr m_zpMemory;
 
     InnerProductPtr m_gemvImpl;
-    InnerProductPtr m_gemmImpl;
+    std::unordered_map<Dim, InnerProductPtr> m_gemmImpls;  // GEMM per normalized number of rows of an expert
 
     MemoryPtr m_tmpInpBuffer;
     MemoryDescPtr m_tmpInputDesc;
     MemoryDescPtr m_tmpOutputDesc;
 
-    bool m_bf16AmxMode = false;
     impl_desc_type m_implType = impl_desc_type::unknown;
 };
 
@@ -17,6 +17,7 @@
 #include "cache/multi_cache.h"
 #include "cpu_memory.h"
 #include "dnnl_scratch_pad.h"
+#include "expert_cache.hpp"
 #include "graph_context.h"
 #include "memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
@@ -57,6 +58,7 @@ public:
         : runtimeCache(graphContext->getParamsCache()),
           scratchPads(graphContext->getScratchPads()),
           weightsCache(graphContext->getWeightsCache()),
+          expertCache(graphContext->getExpertCache()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
@@ -92,6 +94,10 @@ public:
         return weightsCache;
     }
 
+    [[nodiscard]] ExpertCache::Ptr getExpertCache() const {
+        return expertCache;
+    }
+
     [[nodiscard]] std::shared_ptr<CpuParallel> getCpuParallel() const {
         return cpuParallel;
     }
@@ -106,6 +112,7 @@ private:
     MultiCacheWeakPtr runtimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
+    ExpertCache::Ptr expertCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
@@ -0,0 +1,204 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "scaled_attn/common.hpp"
+
+#if defined(HAVE_AVX2)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+// The rows of a bag are read in a random order from a table which usually does not fit any cache level, so
+// the part of the row consumed by the current tile is prefetched this number of indices ahead
+constexpr size_t kPrefetchDistance = 8;
+// Number of the vector accumulators of the main tile
+constexpr size_t kTileVecs = 4;
+
+template <typename T>
+inline const T* row_ptr(const T* table, size_t emb_depth, int32_t index) {
+    return table + static_cast<size_t>(index) * emb_depth;
+}
+
+#if defined(HAVE_AVX512F)
+// Reduces the columns [offset, offset + N * vec_len) of the bag keeping the partial sums in N registers
+template <size_t N, typename T>
+void reduce_tile(float* dst,
+                 const T* table,
+                 size_t emb_depth,
+                 size_t offset,
+                 const int32_t* indices,
+                 size_t num_indices,
+                 const float* weights,
+                 float divisor) {
+    constexpr size_t tile_bytes = N * vec_len_f32_avx512 * sizeof(T);
+    const size_t advance = offset * sizeof(T);
+    for (size_t i = 0; i < kPrefetchDistance && i < num_indices; i++) {
+        prefetch_bytes(tile_bytes, _MM_HINT_T0, advance, row_ptr(table, emb_depth, indices[i]));
+    }
+
+    __m512 acc[N];
+    for (size_t v = 0; v < N; v++) {
+        acc[v] = _mm512_setzero_ps();
+    }
+    for (size_t i = 0; i < num_indices; i++) {
+        if (i + kPrefetchDistance < num_indices) {
+            prefetch_bytes(tile_bytes,
+                           _MM_HINT_T0,
+                           advance,
+                           row_ptr(table, emb_depth, indices[i + kPrefetchDistance]));
+        }
+        const T* src = row_ptr(table, emb_depth, indices[i]) + offset;
+        if (weights) {
+            const auto w = _mm512_set1_ps(weights[i]);
+            for (size_t v = 0; v < N; v++) {
+                acc[v] = _mm512_fmadd_ps(mm512_uni_loadu_ps(src + v * vec_len_f32_avx512), w, acc[v]);
+            }
+        } else {
+            for (size_t v = 0; v < N; v++) {
+                acc[v] = _mm512_add_ps(acc[v], mm512_uni_loadu_ps(src + v * vec_len_f32_avx512));
+            }
+        }
+    }
+
+    const auto vdivisor = _mm512_set1_ps(divisor);
+    for (size_t v = 0; v < N; v++) {
+        _mm512_storeu_ps(dst + offset + v * vec_len_f32_avx512, _mm512_div_ps(acc[v], vdivisor));
+    }
+}
+
+constexpr size_t vec_len = vec_len_f32_avx512;
+#elif defined(HAVE_AVX2)
+template <size_t N, typename T>
+void reduce_tile(float* dst,
+                 const T* table,
+                 size_t emb_depth,
+                 size_t offset,
+                 const int32_t* indices,
+                 size_t num_indices,
+                 const float* weights,
+                 float divisor) {
+    constexpr size_t tile_bytes = N * vec_len_f32_avx2 * sizeof(T);
+    const size_t advance = offset * sizeof(T);
+    for (size_t i = 0; i < kPrefetchDistance && i < num_indices; i++) {
+        prefetch_bytes(tile_bytes, _MM_HINT_T0, advance, row_ptr(table, emb_depth, indices[i]));
+    }
+
+    __m256 acc[N];
+    for (size_t v = 0; v < N; v++) {
+        acc[v] = _mm256_setzero_ps();
+    }
+    for (size_t i = 0; i < num_indices; i++) {
+        if (i + kPrefetchDistance < num_indices) {
+            prefetch_bytes(tile_bytes,
+                           _MM_HINT_T0,
+                           advance,
+                           row_ptr(table, emb_depth, indices[i + kPrefetchDistance]));
+        }
+        const T* src = row_ptr(table, emb_depth, indices[i]) + offset;
+        if (weights) {
+            const auto w = _mm256_set1_ps(weights[i]);
+            for (size_t v = 0; v < N; v++) {
+                acc[v] = _mm256_fmadd_ps(mm256_uni_loadu_ps(src + v * vec_len_f32_avx2), w, acc[v]);
+            }
+        } else {
+            for (size_t v = 0; v < N; v++) {
+                acc[v] = _mm256_add_ps(acc[v], mm256_uni_loadu_ps(src + v * vec_len_f32_avx2));
+            }
+        }
+    }
+
+    const auto vdivisor = _mm256_set1_ps(divisor);
+    for (size_t v = 0; v < N; v++) {
+        _mm256_storeu_ps(dst + offset + v * vec_len_f32_avx2, _mm256_div_ps(acc[v], vdivisor));
+    }
+}
+
+constexpr size_t vec_len = vec_len_f32_avx2;
+#endif
+
+template <typename T>
+void embedding_bag_reduce_impl(float* dst,
+                               const T* table,
+                               size_t emb_depth,
+                               const int32_t* indices,
+                               size_t num_indices,
+                               const float* weights,
+                               float divisor) {
+    size_t d = 0;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    // the row is split by the column tiles and every tile is reduced over all the indices of the bag, so the
+    // partial sums never leave the registers and the destination row is written once
+    for (; d + kTileVecs * vec_len <= emb_depth; d += kTileVecs * vec_len) {
+        reduce_tile<kTileVecs>(dst, table, emb_depth, d, indices, num_indices, weights, divisor);
+    }
+    for (; d + vec_len <= emb_depth; d += vec_len) {
+        reduce_tile<1>(dst, table, emb_depth, d, indices, num_indices, weights, divisor);
+    }
+#endif
+    for (; d < emb_depth; d++) {
+        float acc = 0.F;
+        for (size_t i = 0; i < num_indices; i++) {
+            const float value = static_cast<float>(row_ptr(table, emb_depth, indices[i])[d]);
+            acc += weights ? value * weights[i] : value;
+        }
+        dst[d] = acc / divisor;
+    }
+}
+
+}  // namespace
+
+void embedding_bag_reduce(float* dst,
+                          const void* table,
+                          ov::element::Type table_precision,
+                          size_t emb_depth,
+                          const int32_t* indices,
+                          size_t num_indices,
+                          const float* weights,
+                          float divisor) {
+    switch (table_precision) {
+    case ov::element::f32:
+        embedding_bag_reduce_impl(dst,
+                                  static_cast<const float*>(table),
+                                  emb_depth,
+                                  indices,
+                                  num_indices,
+                                  weights,
+                                  divisor);
+        break;
+    case ov::element::bf16:
+        embedding_bag_reduce_impl(dst,
+                                  static_cast<const ov::bfloat16*>(table),
+                                  emb_depth,
+                                  indices,
+                                  num_indices,
+                                  weights,
+                                  divisor);
+        break;
+    case ov::element::f16:
+        embedding_bag_reduce_impl(dst,
+                                  static_cast<const ov::float16*>(table),
+                                  emb_depth,
+                                  indices,
+                                  num_indices,
+                                  weights,
+                                  divisor);
+        break;
+    default:
+        OPENVINO_THROW("embedding_bag_reduce does not support table precision: ", table_precision);
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
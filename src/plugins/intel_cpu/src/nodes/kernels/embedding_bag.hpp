@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Public entry. The CPU plugin registers this function with `cross_compiled_file`, so a
+// per-ISA (AVX512F/AVX2/ANY) copy is built and the runtime dispatcher picks the right one.
+// Reduces a single bag: dst = sum(table[indices[i]] * weights[i]) / divisor, where the table rows are f32, bf16
+// or f16 and the accumulation is done in f32. weights may be nullptr. The indices must be validated by the caller.
+void embedding_bag_reduce(float* dst,
+                          const void* table,
+                          ov::element::Type table_precision,
+                          size_t emb_depth,
+                          const int32_t* indices,
+                          size_t num_indices,
+                          const float* weights,
+                          float divisor);
+
+}  // namespace ov::Extensions::Cpu::XARCH
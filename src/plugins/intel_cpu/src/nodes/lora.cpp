@@ -4,8 +4,11 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
@@ -13,13 +16,21 @@
 #include "allocation_context.hpp"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "nodes/input.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 
@@ -51,6 +62,56 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_hasAdapterIndices = op->get_input_size() == ADAPTER_INDICES + 1;
+    m_adapterSelectionSupported = m_hasAdapterIndices && isAdapterSelectionBody();
+}
+
+bool LoRA::isAdapterSelectionBody() {
+    // Expected body: Add(main_flow, MatMul(Multiply(MatMul(lora_input, Gather(A)), Gather(alpha)), Gather(B)))
+    const auto& params = m_body->get_parameters();
+    auto isParam = [&](const ov::Output<ov::Node>& output, size_t idx) {
+        return output.get_node() == params[idx].get();
+    };
+    auto isSelectedState = [&](const ov::Output<ov::Node>& output, size_t idx) {
+        const auto* gather = ov::as_type<const ov::op::v8::Gather>(output.get_node());
+        return gather && isParam(gather->input_value(0), idx) && isParam(gather->input_value(1), ADAPTER_INDICES);
+    };
+
+    const auto& results = m_body->get_results();
+    if (results.size() != 1) {
+        return false;
+    }
+    const auto add = ov::as_type_ptr<const ov::op::v1::Add>(results[0]->get_input_node_shared_ptr(0));
+    if (!add) {
+        return false;
+    }
+    const size_t mainFlowPort = isParam(add->input_value(0), MAIN_FLOW) ? 0 : 1;
+    if (!isParam(add->input_value(mainFlowPort), MAIN_FLOW)) {
+        return false;
+    }
+
+    const auto matmulB = ov::as_type_ptr<const ov::op::v0::MatMul>(add->get_input_node_shared_ptr(1 - mainFlowPort));
+    if (!matmulB || matmulB->get_transpose_a() || !isSelectedState(matmulB->input_value(1), STATE_B)) {
+        return false;
+    }
+    const auto multiply = ov::as_type_ptr<const ov::op::v1::Multiply>(matmulB->get_input_node_shared_ptr(0));
+    if (!multiply) {
+        return false;
+    }
+    const size_t alphaPort = isSelectedState(multiply->input_value(0), STATE_ALPHA) ? 0 : 1;
+    if (!isSelectedState(multiply->input_value(alphaPort), STATE_ALPHA)) {
+        return false;
+    }
+    const auto matmulA =
+        ov::as_type_ptr<const ov::op::v0::MatMul>(multiply->get_input_node_shared_ptr(1 - alphaPort));
+    if (!matmulA || matmulA->get_transpose_a() || !isParam(matmulA->input_value(0), LORA_INPUT) ||
+        !isSelectedState(matmulA->input_value(1), STATE_A)) {
+        return false;
+    }
+
+    m_transposedA = matmulA->get_transpose_b();
+    m_transposedB = matmulB->get_transpose_b();
+    return true;
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
@@ -67,7 +128,9 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        // adapter indices are consumed by the states selection, so they keep the integer precision
+        const auto inputPrc = (m_hasAdapterIndices && i == ADAPTER_INDICES) ? ov::element::i32 : mainInputPrc;
+        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(inputPrc);
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -138,9 +201,17 @@ void LoRA::createPrimitive() {
     }
 
     m_graph.Activate();
+
+    if (inputShapesDefined()) {
+        m_useAdapterSelection = canExecuteAdapterSelection();
+    }
 }
 
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_useAdapterSelection) {
+        executeAdapterSelection();
+        return;
+    }
     m_graph.Infer();
 }
 
@@ -153,6 +224,154 @@ void LoRA::prepareParams() {
         // since the external and internal descriptors are compatible, we may pass the descriptor
         subgraphMemoryPtrs[i]->redefineDesc(getSrcMemoryAtPort(i)->getDescPtr());
     }
+    m_useAdapterSelection = canExecuteAdapterSelection();
+}
+
+bool LoRA::canExecuteAdapterSelection() const {
+    if (!m_adapterSelectionSupported) {
+        return false;
+    }
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+        const auto& desc = getSrcMemoryAtPort(i)->getDesc();
+        const auto expectedPrc = i == ADAPTER_INDICES ? ov::element::i32 : ov::element::f32;
+        if (desc.getPrecision() != expectedPrc || !desc.hasLayoutType(LayoutType::ncsp)) {
+            return false;
+        }
+    }
+
+    // the states selection is applied per batch item: x [batch, rows, K], adapter_indices [batch]
+    const auto& mainDims = getSrcMemoryAtPort(MAIN_FLOW)->getStaticDims();
+    const auto& xDims = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(STATE_A)->getStaticDims();
+    const auto& alphaDims = getSrcMemoryAtPort(STATE_ALPHA)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(STATE_B)->getStaticDims();
+    const auto& indicesDims = getSrcMemoryAtPort(ADAPTER_INDICES)->getStaticDims();
+    if (xDims.size() != 3 || mainDims.size() != 3 || aDims.size() != 3 || alphaDims.size() != 3 ||
+        bDims.size() != 3 || indicesDims.size() != 1) {
+        return false;
+    }
+
+    const size_t adapters = aDims[0];
+    const size_t rank = m_transposedA ? aDims[1] : aDims[2];
+    const size_t inputChannels = m_transposedA ? aDims[2] : aDims[1];
+    const size_t bRank = m_transposedB ? bDims[2] : bDims[1];
+    const size_t outputChannels = m_transposedB ? bDims[1] : bDims[2];
+    return indicesDims[0] == xDims[0] && inputChannels == xDims[2] && alphaDims[0] == adapters &&
+           alphaDims[1] == 1 && alphaDims[2] == rank && bDims[0] == adapters && bRank == rank &&
+           mainDims[0] == xDims[0] && mainDims[1] == xDims[1] && mainDims[2] == outputChannels;
+}
+
+void LoRA::executeAdapterSelection() {
+    const auto& xDims = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(STATE_A)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(STATE_B)->getStaticDims();
+    const size_t batch = xDims[0];
+    const size_t rows = xDims[1];
+    const size_t inputChannels = xDims[2];
+    const size_t adapters = aDims[0];
+    const size_t rank = m_transposedA ? aDims[1] : aDims[2];
+    const size_t outputChannels = m_transposedB ? bDims[1] : bDims[2];
+
+    const auto* mainFlow = getSrcDataAtPortAs<const float>(MAIN_FLOW);
+    auto* dst = getDstDataAtPortAs<float>(0);
+    if (dst != mainFlow) {
+        cpu_memcpy(dst, mainFlow, batch * rows * outputChannels * sizeof(float));
+    }
+    // empty adapters leave the main flow as is
+    if (rank == 0 || batch * rows == 0) {
+        return;
+    }
+
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(ADAPTER_INDICES);
+    m_batchAdapters.resize(batch);
+    for (size_t b = 0; b < batch; b++) {
+        auto adapter = static_cast<int64_t>(indices[b]);
+        if (adapter < 0) {
+            adapter += static_cast<int64_t>(adapters);
+        }
+        CPU_NODE_ASSERT(adapter >= 0 && adapter < static_cast<int64_t>(adapters),
+                        "has adapter index ",
+                        indices[b],
+                        " out of range for ",
+                        adapters,
+                        " loaded adapters");
+        m_batchAdapters[b] = static_cast<size_t>(adapter);
+    }
+    // group the batch items by adapter, so every thread applies mostly the same adapter matrices
+    m_batchOrder.resize(batch);
+    std::iota(m_batchOrder.begin(), m_batchOrder.end(), 0);
+    std::stable_sort(m_batchOrder.begin(), m_batchOrder.end(), [&](size_t lhs, size_t rhs) {
+        return m_batchAdapters[lhs] < m_batchAdapters[rhs];
+    });
+
+    const auto* x = getSrcDataAtPortAs<const float>(LORA_INPUT);
+    const auto* stateA = getSrcDataAtPortAs<const float>(STATE_A);
+    const auto* stateAlpha = getSrcDataAtPortAs<const float>(STATE_ALPHA);
+    const auto* stateB = getSrcDataAtPortAs<const float>(STATE_B);
+    const bool transposedA = m_transposedA;
+    const bool transposedB = m_transposedB;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(batch * rows, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+        std::vector<float> lowRank(rank);
+        for (size_t i = start; i < end; i++) {
+            const size_t b = m_batchOrder[i / rows];
+            const size_t row = b * rows + i % rows;
+            const size_t adapter = m_batchAdapters[b];
+            const float* src = x + row * inputChannels;
+            const float* a = stateA + adapter * rank * inputChannels;
+            const float* alpha = stateAlpha + adapter * rank;
+            const float* bMatrix = stateB + adapter * outputChannels * rank;
+            float* out = dst + row * outputChannels;
+
+            // lowRank = (src * A^T) * alpha
+            if (transposedA) {
+                for (size_t r = 0; r < rank; r++) {
+                    const float* aRow = a + r * inputChannels;
+                    float acc = 0.0F;
+                    for (size_t k = 0; k < inputChannels; k++) {
+                        acc += src[k] * aRow[k];
+                    }
+                    lowRank[r] = acc;
+                }
+            } else {
+                std::fill(lowRank.begin(), lowRank.end(), 0.0F);
+                for (size_t k = 0; k < inputChannels; k++) {
+                    const float* aRow = a + k * rank;
+                    for (size_t r = 0; r < rank; r++) {
+                        lowRank[r] += src[k] * aRow[r];
+                    }
+                }
+            }
+            for (size_t r = 0; r < rank; r++) {
+                lowRank[r] *= alpha[r];
+            }
+
+            // out += lowRank * B^T
+            if (transposedB) {
+                for (size_t o = 0; o < outputChannels; o++) {
+                    const float* bRow = bMatrix + o * rank;
+                    float acc = 0.0F;
+                    for (size_t r = 0; r < rank; r++) {
+                        acc += lowRank[r] * bRow[r];
+                    }
+                    out[o] += acc;
+                }
+            } else {
+                for (size_t r = 0; r < rank; r++) {
+                    const float* bRow = bMatrix + r * outputChannels;
+                    for (size_t o = 0; o < outputChannels; o++) {
+                        out[o] += lowRank[r] * bRow[o];
+                    }
+                }
+            }
+        }
+    });
 }
 
 }  // namespace ov::intel_cpu::node
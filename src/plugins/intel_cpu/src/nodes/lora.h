@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -39,9 +41,26 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    enum InputIdx : uint8_t { MAIN_FLOW = 0, LORA_INPUT, STATE_A, STATE_ALPHA, STATE_B, ADAPTER_INDICES };
+
+    bool isAdapterSelectionBody();
+    bool canExecuteAdapterSelection() const;
+    void executeAdapterSelection();
+
     std::shared_ptr<const ov::Model> m_body;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
+
+    // Multi-adapter mode: the states hold stacked adapters, each batch row selects its adapter by index.
+    // The rows are grouped by adapter and the matrices are applied directly instead of running the inner graph,
+    // which would gather a copy of the adapter matrices for every row.
+    bool m_hasAdapterIndices = false;
+    bool m_adapterSelectionSupported = false;
+    bool m_useAdapterSelection = false;
+    bool m_transposedA = true;
+    bool m_transposedB = true;
+    std::vector<size_t> m_batchAdapters;
+    std::vector<size_t> m_batchOrder;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -8,7 +8,6 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,6 +18,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/enum_names.hpp"
 #include "openvino/core/except.hpp"
@@ -193,26 +193,20 @@ size_t MatrixNms::nmsMatrix(const float* boxesData,
                             BoxInfo* filterBoxes,
                             const int64_t batchIdx,
                             const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    // all the nms_top_k best candidates are consumed, so they are selected and sorted at once
+    const auto topk = m_nmsTopk > -1 ? static_cast<size_t>(m_nmsTopk) : m_numBoxes;
+    NmsCandidates candidates;
+    candidates.collect(scoresData, m_numBoxes, m_scoreThreshold, false, topk, topk);
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    const auto originalSize = static_cast<int64_t>(candidates.size());
     if (originalSize <= 0) {
         return 0;
     }
-    if (m_nmsTopk > -1 && originalSize > m_nmsTopk) {
-        originalSize = m_nmsTopk;
-    }
 
-    std::partial_sort(candidateIndex.begin(),
-                      candidateIndex.begin() + originalSize,
-                      end,
-                      [&scoresData](int32_t a, int32_t b) {
-                          return scoresData[a] > scoresData[b];
-                      });
+    std::vector<int32_t> candidateIndex(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        candidateIndex[i] = candidates[i].second;
+    }
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
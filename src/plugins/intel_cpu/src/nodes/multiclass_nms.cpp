@@ -23,6 +23,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -628,44 +629,33 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* scoresPtr =
                 slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            // only the nms_top_k best candidates are visited, so the rest ones are never sorted
+            NmsCandidates sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold) {  // align with ref
-                    sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-                }
-            }
+            sorted_boxes.collect(scoresPtr,
+                                 static_cast<size_t>(cur_numBoxes),
+                                 m_scoreThreshold,
+                                 true,  // align with ref
+                                 static_cast<size_t>(m_nmsRealTopk),
+                                 static_cast<size_t>(m_nmsRealTopk));
 
             int io_selection_size = 0;
             if (!sorted_boxes.empty()) {
-                parallel_sort(sorted_boxes.begin(),
-                              sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                              });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] =
                     filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                                                          &boxesPtr[m_filtBoxes[offset + idx].box_index * 4],
-                                                          m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[box_idx].second);
+                NmsSelectedBoxes selected(sorted_boxes.size(), static_cast<float>(!m_normalized));
+                const float* firstBox = &boxesPtr[sorted_boxes[0].second * 4];
+                selected.push(firstBox[0], firstBox[1], firstBox[2], firstBox[3]);
+                for (size_t box_idx = 1; box_idx < sorted_boxes.size(); box_idx++) {
+                    const auto& candidate = sorted_boxes[box_idx];
+                    const float* box = &boxesPtr[candidate.second * 4];
+                    if (!selected.suppresses(box[0], box[1], box[2], box[3], m_iouThreshold)) {
+                        selected.push(box[0], box[1], box[2], box[3]);
+                        m_filtBoxes[offset + io_selection_size] =
+                            filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
                         io_selection_size++;
                     }
                 }
@@ -4,11 +4,13 @@
 
 #include "multinomial.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <openvino/core/type.hpp>
 #include <openvino/op/constant.hpp>
@@ -127,10 +129,8 @@ void Multinomial::prepareParams() {
 
     m_batches_count = probs_shape[0];
     m_probs_count = probs_shape[1];
-    m_samples_probs_count = m_samples_count * m_probs_count;
     m_input_elements_count = m_batches_count * m_probs_count;
     m_output_elements_count = m_batches_count * m_samples_count;
-    m_batches_samples_probs_count = m_output_elements_count * m_probs_count;
 }
 
 bool Multinomial::neverExecute() const {
@@ -186,26 +186,8 @@ void Multinomial::execute_convert_type() {
     const auto& cpu_parallel = context->getCpuParallel();
 
     std::vector<P> m_cdf(m_input_elements_count);
-    std::vector<P> m_max_per_batch(m_batches_count);
     std::vector<P> m_random_samples(m_output_elements_count);
 
-    // exp & cumsum
-    if (m_log_probs) {
-        cpu_parallel->parallel_for(m_batches_count, [&](size_t idx) {
-            const auto start_idx = idx * m_probs_count;
-            m_cdf[start_idx] = std::exp(probs[start_idx]);
-            for (size_t prev = start_idx, curr = prev + 1; curr < (start_idx + m_probs_count); ++prev, ++curr) {
-                m_cdf[curr] = std::exp(probs[curr]) + m_cdf[prev];
-            }
-        });
-    } else {
-        cpu_parallel->parallel_for(m_batches_count, [&](size_t idx_batch) {
-            const auto start_idx = idx_batch * m_probs_count;
-            const auto* probs_start_idx = probs + start_idx;
-            std::partial_sum(probs_start_idx, probs_start_idx + m_probs_count, m_cdf.begin() + start_idx);
-        });
-    }
-
     // TODO RandomUniform - should use RandomUniform kernel to match other frameworks' seed results
     std::mt19937 gen;
     if (all_of(0U, m_global_seed, m_op_seed)) {
@@ -220,29 +202,38 @@ void Multinomial::execute_convert_type() {
         return static_cast<P>(static_cast<float>(gen()) / gen_max);
     });
 
-    // max & divide
+    // exp & cumsum & max & divide, a row is normalized while it is still in the cache
     const auto min_value_of_max = std::numeric_limits<P>::min();
-    cpu_parallel->parallel_for(m_batches_count, [&](size_t idx) {
-        m_max_per_batch[idx] = std::max(m_cdf[(idx + 1) * m_probs_count - 1], min_value_of_max);
+    cpu_parallel->parallel_for(m_batches_count, [&](size_t idx_batch) {
+        const auto* probs_start = probs + idx_batch * m_probs_count;
+        auto* cdf_start = m_cdf.data() + idx_batch * m_probs_count;
+        if (m_log_probs) {
+            cdf_start[0] = std::exp(probs_start[0]);
+            for (size_t idx = 1; idx < m_probs_count; ++idx) {
+                cdf_start[idx] = std::exp(probs_start[idx]) + cdf_start[idx - 1];
+            }
+        } else {
+            std::partial_sum(probs_start, probs_start + m_probs_count, cdf_start);
+        }
+        const P max_value = std::max(cdf_start[m_probs_count - 1], min_value_of_max);
+        for (size_t idx = 0; idx < m_probs_count; ++idx) {
+            cdf_start[idx] = cdf_start[idx] / max_value;
+        }
     });
 
-    cpu_parallel->parallel_for(m_input_elements_count, [&](size_t idx) {
-        size_t idx_max_elem = idx / m_probs_count;
-        m_cdf[idx] = m_cdf[idx] / m_max_per_batch[idx_max_elem];
-    });
+    // the selected class is the first one with the cdf not less than the sample, the cdf of the valid non negative
+    // probabilities is non decreasing, so the class is found by the binary search instead of the scan of the row
+    auto select_class = [&](const P* cdf_start, P sample_value) {
+        return static_cast<size_t>(std::lower_bound(cdf_start, cdf_start + m_probs_count, sample_value) - cdf_start);
+    };
 
     if (m_with_replacement) {
-        cpu_parallel->parallel_for(m_batches_samples_probs_count, [&](size_t idx) {
-            size_t idx_batch = idx / m_samples_probs_count;
-            size_t idx_num_samples_probs = idx % m_samples_probs_count;
-            size_t idx_prob = idx_num_samples_probs % m_probs_count;
-            size_t idx_sample = idx_num_samples_probs / m_probs_count;
-
-            size_t idx_input = idx_batch * m_probs_count + idx_prob;
-            size_t idx_output = idx_batch * m_samples_count + idx_sample;
-            if (m_random_samples[idx_output] <= m_cdf[idx_input] &&
-                (!idx_prob || m_random_samples[idx_output] > m_cdf[idx_input - 1])) {
-                output[idx_output] = static_cast<O>(idx_prob);
+        cpu_parallel->parallel_for(m_output_elements_count, [&](size_t idx_output) {
+            const size_t idx_batch = idx_output / m_samples_count;
+            const size_t selected_class = select_class(m_cdf.data() + idx_batch * m_probs_count,
+                                                       m_random_samples[idx_output]);
+            if (selected_class < m_probs_count) {
+                output[idx_output] = static_cast<O>(selected_class);
             }
         });
     } else {  // without replacement - adjust cdf after each sample drawn from batch, sequentially
@@ -251,19 +242,9 @@ void Multinomial::execute_convert_type() {
                 size_t idx_input = idx_batch * m_probs_count;
                 size_t idx_output = idx_batch * m_samples_count + idx_sample;
 
-                bool class_selected = false;
-                size_t selected_class = m_probs_count;
-                P sample_value = m_random_samples[idx_output];
-                for (size_t idx_prob = 0LU; idx_prob < m_probs_count; ++idx_prob) {
-                    if (sample_value <= m_cdf[idx_input + idx_prob]) {
-                        output[idx_output] = static_cast<O>(idx_prob);
-                        selected_class = idx_prob;
-                        class_selected = true;
-                        break;
-                    }
-                }
-
-                if (class_selected) {
+                const size_t selected_class = select_class(m_cdf.data() + idx_input, m_random_samples[idx_output]);
+                if (selected_class < m_probs_count) {
+                    output[idx_output] = static_cast<O>(selected_class);
                     P class_probability = [&]() -> P {
                         if (selected_class) {
                             return m_cdf[idx_input + selected_class] - m_cdf[idx_input + selected_class - 1];
@@ -68,10 +68,8 @@ private:
     size_t m_probs_count = 0;
     size_t m_batches_count = 0;
     size_t m_samples_count = 0;
-    size_t m_samples_probs_count = 0;
     size_t m_input_elements_count = 0;
     size_t m_output_elements_count = 0;
-    size_t m_batches_samples_probs_count = 0;
 
     template <typename P>
     void execute_probs_type();
@@ -27,6 +27,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.h"
 #include "nodes/kernels/x64/non_max_suppression.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -289,28 +290,63 @@ void NonMaxSuppression::execute([[maybe_unused]] const dnnl::stream& strm) {
         nmsWithSoftSigma(boxes, scores, boxes_strides, scores_strides, m_filtered_boxes);
     }
 
-    size_t start_offset = m_num_filtered_boxes[0][0];
-    for (size_t b = 0LU; b < m_num_filtered_boxes.size(); b++) {
-        size_t batchOffset = b * m_classes_num * m_output_boxes_per_class;
-        for (size_t c = (b == 0LU ? 1LU : 0LU); c < m_num_filtered_boxes[b].size(); c++) {
-            size_t offset = batchOffset + c * m_output_boxes_per_class;
-            for (size_t i = 0LU; i < m_num_filtered_boxes[b][c]; i++) {
-                m_filtered_boxes[start_offset + i] = m_filtered_boxes[offset + i];
+    // need more particular comparator to get deterministic behaviour
+    // escape situation when filtred boxes with same score have different position from launch to launch
+    auto descending = [](const FilteredBox& l, const FilteredBox& r) {
+        return (l.score > r.score) || (l.score == r.score && l.batch_index < r.batch_index) ||
+               (l.score == r.score && l.batch_index == r.batch_index && l.class_index < r.class_index) ||
+               (l.score == r.score && l.batch_index == r.batch_index && l.class_index == r.class_index &&
+                l.box_index < r.box_index);
+    };
+
+    size_t start_offset = 0LU;
+    if (m_sort_result_descending && !m_rotated_boxes && m_soft_nms_sigma == 0.F) {
+        // the hard NMS selects the boxes of every class in the descending order already, so the classes of all the
+        // batches are merged at once instead of the compaction and the sort of all the selected boxes
+        std::vector<std::pair<size_t, size_t>> ranges;  // current and end position of the selected boxes of a class
+        for (size_t b = 0LU; b < m_num_filtered_boxes.size(); b++) {
+            for (size_t c = 0LU; c < m_num_filtered_boxes[b].size(); c++) {
+                const size_t offset = (b * m_classes_num + c) * m_output_boxes_per_class;
+                if (m_num_filtered_boxes[b][c] > 0LU) {
+                    ranges.emplace_back(offset, offset + m_num_filtered_boxes[b][c]);
+                }
+                start_offset += m_num_filtered_boxes[b][c];
+            }
+        }
+        auto worse = [&](const std::pair<size_t, size_t>& l, const std::pair<size_t, size_t>& r) {
+            return descending(m_filtered_boxes[r.first], m_filtered_boxes[l.first]);
+        };
+        std::priority_queue<std::pair<size_t, size_t>, std::vector<std::pair<size_t, size_t>>, decltype(worse)> heads(
+            worse,
+            std::move(ranges));
+        std::vector<FilteredBox> merged;
+        merged.reserve(start_offset);
+        while (!heads.empty()) {
+            auto head = heads.top();
+            heads.pop();
+            merged.push_back(m_filtered_boxes[head.first++]);
+            if (head.first < head.second) {
+                heads.push(head);
+            }
+        }
+        std::copy(merged.begin(), merged.end(), m_filtered_boxes.begin());
+    } else {
+        start_offset = m_num_filtered_boxes[0][0];
+        for (size_t b = 0LU; b < m_num_filtered_boxes.size(); b++) {
+            size_t batchOffset = b * m_classes_num * m_output_boxes_per_class;
+            for (size_t c = (b == 0LU ? 1LU : 0LU); c < m_num_filtered_boxes[b].size(); c++) {
+                size_t offset = batchOffset + c * m_output_boxes_per_class;
+                for (size_t i = 0LU; i < m_num_filtered_boxes[b][c]; i++) {
+                    m_filtered_boxes[start_offset + i] = m_filtered_boxes[offset + i];
+                }
+                start_offset += m_num_filtered_boxes[b][c];
             }
-            start_offset += m_num_filtered_boxes[b][c];
         }
-    }
 
-    auto* boxes_ptr = m_filtered_boxes.data();
-    // need more particular comparator to get deterministic behaviour
-    // escape situation when filtred boxes with same score have different position from launch to launch
-    if (m_sort_result_descending) {
-        parallel_sort(boxes_ptr, boxes_ptr + start_offset, [](const FilteredBox& l, const FilteredBox& r) {
-            return (l.score > r.score) || (l.score == r.score && l.batch_index < r.batch_index) ||
-                   (l.score == r.score && l.batch_index == r.batch_index && l.class_index < r.class_index) ||
-                   (l.score == r.score && l.batch_index == r.batch_index && l.class_index == r.class_index &&
-                    l.box_index < r.box_index);
-        });
+        if (m_sort_result_descending) {
+            auto* boxes_ptr = m_filtered_boxes.data();
+            parallel_sort(boxes_ptr, boxes_ptr + start_offset, descending);
+        }
     }
 
     const size_t valid_outputs = std::min(start_offset, max_number_of_boxes);
@@ -523,32 +559,29 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
         const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        sorted_boxes.reserve(m_boxes_num);
-        for (size_t box_idx = 0; box_idx < m_boxes_num; box_idx++) {
-            if (scoresPtr[box_idx] > m_score_threshold) {
-                sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-            }
-        }
+        // the candidates are sorted lazily, at most max_out_box of them are selected
+        NmsCandidates sorted_boxes;
+        sorted_boxes.collect(scoresPtr,
+                             m_boxes_num,
+                             m_score_threshold,
+                             false,
+                             static_cast<size_t>(-1),
+                             m_output_boxes_per_class);
 
         int io_selection_size = 0;
         const size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0LU) {
-            parallel_sort(sorted_boxes.begin(),
-                          sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
             int offset = batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
             filtBoxes[offset + 0] = FilteredBox(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
             if (sortedBoxSize > 1LU) {
                 if (m_jit_kernel) {
 #if defined(OPENVINO_ARCH_X86_64)
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0F);
+                    const size_t maxSelected = std::min(sortedBoxSize, m_output_boxes_per_class);
+                    std::vector<float> boxCoord0(maxSelected, 0.0F);
+                    std::vector<float> boxCoord1(maxSelected, 0.0F);
+                    std::vector<float> boxCoord2(maxSelected, 0.0F);
+                    std::vector<float> boxCoord3(maxSelected, 0.0F);
 
                     boxCoord0[0] = boxesPtr[sorted_boxes[0].second * m_coord_num];
                     boxCoord1[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 1];
@@ -567,46 +600,52 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
 
                     for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
                          candidate_idx++) {
+                        const auto& candidate = sorted_boxes[candidate_idx];
                         int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = (&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num]);
+                        arg.candidate_box = (&boxesPtr[candidate.second * m_coord_num]);
                         arg.candidate_status = (&candidateStatus);
                         (*m_jit_kernel)(&arg);
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num];
-                            boxCoord1[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 1];
-                            boxCoord2[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 2];
-                            boxCoord3[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 3];
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
+                            boxCoord0[io_selection_size] = boxesPtr[candidate.second * m_coord_num];
+                            boxCoord1[io_selection_size] = boxesPtr[candidate.second * m_coord_num + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[candidate.second * m_coord_num + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[candidate.second * m_coord_num + 3];
+                            filtBoxes[offset + io_selection_size] =
+                                FilteredBox(candidate.first, batch_idx, class_idx, candidate.second);
                             io_selection_size++;
                         }
                     }
 #endif  // OPENVINO_ARCH_X86_64
                 } else {
+                    // box corners in the form used by intersectionOverUnion
+                    auto corners = [&](int box_idx) {
+                        const float* box = &boxesPtr[box_idx * m_coord_num];
+                        if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+                            return std::tuple{box[1] - box[3] / 2.F,
+                                              box[0] - box[2] / 2.F,
+                                              box[1] + box[3] / 2.F,
+                                              box[0] + box[2] / 2.F};
+                        }
+                        return std::tuple{(std::min)(box[0], box[2]),
+                                          (std::min)(box[1], box[3]),
+                                          (std::max)(box[0], box[2]),
+                                          (std::max)(box[1], box[3])};
+                    };
+
+                    NmsSelectedBoxes selected(std::min(sortedBoxSize, m_output_boxes_per_class));
+                    {
+                        const auto [ymin, xmin, ymax, xmax] = corners(sorted_boxes[0].second);
+                        selected.push(ymin, xmin, ymax, xmax);
+                    }
                     for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
                          candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(
-                                &boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * m_coord_num]);
-                            if (iou >= m_iou_threshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
-
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
+                        const auto& candidate = sorted_boxes[candidate_idx];
+                        const auto [ymin, xmin, ymax, xmax] = corners(candidate.second);
+                        if (!selected.suppresses(ymin, xmin, ymax, xmax, m_iou_threshold)) {
+                            selected.push(ymin, xmin, ymax, xmax);
+                            filtBoxes[offset + io_selection_size] =
+                                FilteredBox(candidate.first, batch_idx, class_idx, candidate.second);
                             io_selection_size++;
                         }
                     }
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/fft_plan.h"
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
@@ -334,6 +335,7 @@ void RDFTExecutor::execute(float* inputPtr,
 
     if (rank == 1) {
         const auto* twiddlesPtr = twiddles[0].data();
+        const auto plan = getFFTPlan(signalSizes[0]);
         dftCommon(inputPtr,
                   twiddlesPtr,
                   outputPtr,
@@ -342,6 +344,7 @@ void RDFTExecutor::execute(float* inputPtr,
                   outputShape[0],
                   isInverse ? complex_to_real : real_to_complex,
                   canUseFFT(signalSizes[0]),
+                  plan.get(),
                   false,
                   cpuParallel);
     } else {
@@ -459,6 +462,10 @@ bool RDFTExecutor::canUseFFT(size_t dim) {
     return isPowerOfTwo(dim) && dim > 1;
 }
 
+std::shared_ptr<const FFTPlan> RDFTExecutor::getFFTPlan(size_t dim) const {
+    return FFTPlan::isBeneficial(dim) ? FFTPlan::get(dim, isInverse) : nullptr;
+}
+
 static void fftCopyInverseInputData(float* dst,
                                     float* src,
                                     size_t inputSize,
@@ -598,6 +605,42 @@ void RDFTExecutor::fft(float* input,
     }
 }
 
+void RDFTExecutor::planFFT(const FFTPlan& plan,
+                           const float* input,
+                           float* output,
+                           size_t inputSize,
+                           size_t signalSize,
+                           size_t outputSize,
+                           enum dft_type type) const {
+    std::vector<float> buffer(2 * signalSize + plan.getScratchSize(), 0);
+    float* data = buffer.data();
+    const size_t copySize = std::min(inputSize, signalSize);
+    if (type == real_to_complex) {
+        for (size_t i = 0; i < copySize; i++) {
+            data[2 * i] = input[i];
+        }
+    } else {
+        cpu_memcpy(data, input, copySize * complex_type_size<float>());
+        if (type == complex_to_real) {
+            // restore the omitted half of the hermitian symmetric input
+            for (size_t i = copySize; i < signalSize; i++) {
+                data[2 * i] = data[2 * (signalSize - i)];
+                data[2 * i + 1] = -data[2 * (signalSize - i) + 1];
+            }
+        }
+    }
+
+    plan.execute(data, data + 2 * signalSize);
+
+    if (type == complex_to_real) {
+        for (size_t i = 0; i < signalSize; i++) {
+            output[i] = data[2 * i];
+        }
+    } else {
+        cpu_memcpy(output, data, outputSize * complex_type_size<float>());
+    }
+}
+
 void RDFTExecutor::dftCommon(float* inputPtr,
                              const float* twiddlesPtr,
                              float* outputPtr,
@@ -606,10 +649,13 @@ void RDFTExecutor::dftCommon(float* inputPtr,
                              size_t outputSize,
                              enum dft_type type,
                              bool useFFT,
+                             const FFTPlan* plan,
                              bool parallelize,
                              const CpuParallelPtr& cpuParallel) {
     if (useFFT) {
         fft(inputPtr, twiddlesPtr, outputPtr, inputSize, signalSize, outputSize, type, parallelize, cpuParallel);
+    } else if (plan) {
+        planFFT(*plan, inputPtr, outputPtr, inputSize, signalSize, outputSize, type);
     } else {
         dft(inputPtr, twiddlesPtr, outputPtr, inputSize, signalSize, outputSize, type, parallelize, cpuParallel);
     }
@@ -668,6 +714,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
     }
 
     bool useFFT = canUseFFT(signalSize);
+    const auto plan = useFFT ? nullptr : getFFTPlan(signalSize);
 
     size_t totalWorkSize =
         std::accumulate(iterationRange.begin(), iterationRange.end(), 1, std::multiplies<>()) / iterationRange[axis];
@@ -689,6 +736,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
                       outputSize,
                       type,
                       useFFT,
+                      plan.get(),
                       !parallelizeOuterAxes,
                       cpuParallel);
             scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
@@ -709,6 +757,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
                       outputSize,
                       type,
                       useFFT,
+                      plan.get(),
                       !parallelizeOuterAxes,
                       cpuParallel);
             scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
@@ -854,6 +903,10 @@ std::vector<float> RDFTExecutor::generateTwiddlesCommon(size_t signalSize,
     if (useFFT) {
         return generateTwiddlesFFT(signalSize);
     }
+    if (FFTPlan::isBeneficial(signalSize)) {
+        // the FFT plan keeps its own twiddles
+        return {};
+    }
     return generateTwiddlesDFT(signalSize, outputSize, cpuParallel, type);
 }
 
@@ -10,6 +10,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "common/fft_plan.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "kernels/x64/rdft_kernel.hpp"
@@ -46,6 +47,14 @@ protected:
 
 private:
     virtual bool canUseFFT(size_t dim);
+    [[nodiscard]] std::shared_ptr<const FFTPlan> getFFTPlan(size_t dim) const;
+    void planFFT(const FFTPlan& plan,
+                 const float* input,
+                 float* output,
+                 size_t inputSize,
+                 size_t signalSize,
+                 size_t outputSize,
+                 enum dft_type type) const;
     virtual void dft(float* inputPtr,
                      const float* twiddlesPtr,
                      float* outputPtr,
@@ -72,6 +81,7 @@ private:
                    size_t outputSize,
                    enum dft_type type,
                    bool useFFT,
+                   const FFTPlan* plan,
                    bool parallelize,
                    const CpuParallelPtr& cpuParallel);
     void dftOnAxis(enum dft_type type,
@@ -186,8 +186,15 @@ public:
     BackEdgePortHelper(const MultiCachePtr& cache, const MemoryPtr& from, const MemoryPtr& to) {
         mem_holder_src = from->getPrimitive();
         mem_holder_dst = to->getPrimitive();
-        reorder =
-            getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        // the same layout on both sides is the common case for back edges and body outputs,
+        // so the data is moved by a plain copy without a reorder primitive lookup and execution
+        direct_copy = mem_holder_src.get_desc() == mem_holder_dst.get_desc();
+        if (!direct_copy) {
+            reorder = getReorderPrim(cache,
+                                     mem_holder_dst.get_engine(),
+                                     mem_holder_src.get_desc(),
+                                     mem_holder_dst.get_desc());
+        }
     }
 
     void execute(const dnnl::stream& strm, int iter) override {
@@ -196,9 +203,21 @@ public:
                 return;
             }
 
+            if (direct_copy) {
+                const auto* src = mem_holder_src.get_data_handle();
+                auto* dst = mem_holder_dst.get_data_handle();
+                if (src != dst) {
+                    cpu_parallel_memcpy(dst, src, mem_holder_src.get_desc().get_size());
+                }
+                return;
+            }
+
             reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
         }
     }
+
+private:
+    bool direct_copy = false;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -445,6 +464,11 @@ void DynamicBuffer::copy(const uint8_t* src,
                          const size_t count,
                          const size_t len,
                          const std::shared_ptr<CpuParallel>& cpu_parallel) {
+    // concatenation along the outermost non-unit axis gives a single contiguous chunk, which is split by threads
+    if (count == 1) {
+        cpu_parallel_memcpy(dst, src, len);
+        return;
+    }
     cpu_parallel->parallel_for(count, [&](const size_t i) {
         cpu_memcpy(&dst[i * dst_stride], &src[i * src_stride], len);
     });
@@ -14,10 +14,10 @@
 #include <openvino/op/constant.hpp>
 #include <openvino/op/unique.hpp>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/unique_utils.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -185,112 +185,52 @@ void Unique::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <typename T>
 void Unique::flattenTensorExec() {
+    const auto& cpu_parallel = context->getCpuParallel();
     const T* srcDataPtr = getSrcDataAtPortAs<const T>(IN_DATA);
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int* firstTmpPtr = nullptr;
-    int* inToOutTmpPtr = nullptr;
-    int* occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
 
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto* last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
+    // the groups of the equal elements are numbered in the order of their first occurrences
+    std::vector<int32_t> firsts;
+    std::vector<int32_t> counts;
+    uniqueLen = groupUniqueElements(srcDataPtr, inputLen, inToOutTmp.data(), firsts, counts);
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
-    } else {
-        std::unordered_map<T, int32_t> uniq;
-        uniq.reserve(inputLen);
-
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-
-        for (size_t i = 0, j = 0; i < inputLen; ++i) {
-            auto it = uniq.emplace(srcDataPtr[i], j);
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = it.first->second;
-                if (it.second) {
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        firstTmpPtr[j] = i;
-                    }
-                    ++j;
-                } else {
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        occurTmpPtr[inToOutTmpPtr[i]]++;
-                    }
-                }
-            }
-        }
-
-        uniqueLen = static_cast<int64_t>(uniq.size());
-        for (const auto& it : uniq) {
-            uniDataTmpPtr[it.second] = it.first;
-        }
+    // the group of every output position, only the unique values are sorted instead of the whole input
+    std::vector<int32_t> groups(uniqueLen);
+    std::iota(groups.begin(), groups.end(), 0);
+    if (sorted) {
+        std::sort(groups.begin(), groups.end(), [&](int32_t l, int32_t r) {
+            return srcDataPtr[firsts[l]] < srcDataPtr[firsts[r]];
+        });
     }
 
     redefineOutputMemory({{uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
     T* uniDataPtr = getDstDataAtPortAs<T>(UNIQUE_DATA);
-    cpu_parallel_memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        auto* firstPtr = getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX);
-        cpu_parallel_memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
+    int* firstPtr = definedOutputs[FIRST_UNIQUE_IDX] ? getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX) : nullptr;
+    int* occurPtr = definedOutputs[OCCURRENCES_NUM] ? getDstDataAtPortAs<int>(OCCURRENCES_NUM) : nullptr;
+    cpu_parallel->parallel_for(uniqueLen, [&](size_t pos) {
+        const auto group = groups[pos];
+        uniDataPtr[pos] = srcDataPtr[firsts[group]];
+        if (firstPtr) {
+            firstPtr[pos] = firsts[group];
+        }
+        if (occurPtr) {
+            occurPtr[pos] = counts[group];
+        }
+    });
     if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
         auto* inToOutPtr = getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX);
-        cpu_parallel_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto* occurPtr = getDstDataAtPortAs<int>(OCCURRENCES_NUM);
-        cpu_parallel_memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
+        if (sorted) {
+            std::vector<int32_t> positions(uniqueLen);
+            cpu_parallel->parallel_for(uniqueLen, [&](size_t pos) {
+                positions[groups[pos]] = static_cast<int32_t>(pos);
+            });
+            cpu_parallel->parallel_for(inputLen, [&](size_t i) {
+                inToOutPtr[i] = positions[inToOutTmp[i]];
+            });
+        } else {
+            cpu_parallel_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
+        }
     }
 }
 
@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ratio>
+#include <string>
 
 namespace ov::intel_cpu {
 
@@ -58,6 +63,161 @@ public:
     }
 };
 
+/**
+ * @brief Latency histogram with log2 buckets used by the sampling profiler.
+ * Bucket i accumulates durations in [2^(i-1), 2^i) nanoseconds, bucket 0 holds zero durations.
+ * Once the number of recorded samples reaches the rolling window all the counters are halved,
+ * so the histogram reflects recent behavior rather than the whole lifetime of the model.
+ */
+class PerfHistogram {
+public:
+    static constexpr size_t bucketsNum = 48;
+    static constexpr uint64_t rollingWindow = 4096;
+
+    void add(uint64_t duration_ns) {
+        if (num >= rollingWindow) {
+            decay();
+        }
+        const auto bucket = static_cast<size_t>(64 - countl_zero(duration_ns));
+        buckets[std::min(bucket, bucketsNum - 1)]++;
+        total_duration += duration_ns;
+        num++;
+    }
+
+    void merge(const PerfHistogram& other) {
+        for (size_t i = 0; i < bucketsNum; i++) {
+            buckets[i] += other.buckets[i];
+        }
+        total_duration += other.total_duration;
+        num += other.num;
+    }
+
+    void reset() {
+        buckets.fill(0);
+        total_duration = 0;
+        num = 0;
+    }
+
+    [[nodiscard]] uint64_t count() const {
+        return num;
+    }
+
+    [[nodiscard]] uint64_t total() const {
+        return total_duration;
+    }
+
+    [[nodiscard]] uint64_t avg() const {
+        return (num == 0) ? 0 : total_duration / num;
+    }
+
+    /**
+     * @brief Returns the upper bound (in nanoseconds) of the bucket holding the requested percentile
+     * @param p percentile in the range [0, 1]
+     */
+    [[nodiscard]] uint64_t percentile(double p) const {
+        if (num == 0) {
+            return 0;
+        }
+        const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(p * static_cast<double>(num) + 0.5));
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < bucketsNum; i++) {
+            accumulated += buckets[i];
+            if (accumulated >= target) {
+                return i == 0 ? 0 : (uint64_t{1} << i) - 1;
+            }
+        }
+        return (uint64_t{1} << (bucketsNum - 1)) - 1;
+    }
+
+private:
+    static size_t countl_zero(uint64_t value) {
+        if (value == 0) {
+            return 64;
+        }
+        size_t n = 0;
+        for (uint64_t mask = uint64_t{1} << 63; (value & mask) == 0; mask >>= 1) {
+            n++;
+        }
+        return n;
+    }
+
+    void decay() {
+        uint64_t decayed = 0;
+        for (auto& bucket : buckets) {
+            bucket >>= 1;
+            decayed += bucket;
+        }
+        total_duration = num == 0 ? 0 : total_duration * decayed / num;
+        num = decayed;
+    }
+
+    std::array<uint64_t, bucketsNum> buckets{};
+    uint64_t total_duration = 0;
+    uint64_t num = 0;
+};
+
+/**
+ * @brief Runtime switch of the sampling profiler shared by all the graphs (streams) of a compiled model.
+ * Interval N means that every N-th inference of a graph is profiled, zero disables sampling.
+ * Each change of the interval bumps the generation, which makes the graphs drop the collected histograms.
+ */
+class PerfSampler {
+public:
+    void setInterval(uint32_t value) {
+        interval.store(value, std::memory_order_relaxed);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    [[nodiscard]] uint32_t getInterval() const {
+        return interval.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t getGeneration() const {
+        return generation.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<uint32_t> interval{0};
+    std::atomic<uint64_t> generation{0};
+};
+
+/**
+ * @brief Records the lifetime of the helper into the given histogram, does nothing if the histogram is null
+ */
+class PerfSampleHelper {
+    PerfHistogram* histogram;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit PerfSampleHelper(PerfHistogram* hist) : histogram(hist) {
+        if (histogram) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PerfSampleHelper() {
+        if (histogram) {
+            const auto duration = std::chrono::steady_clock::now() - start;
+            histogram->add(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+    }
+
+    PerfSampleHelper(const PerfSampleHelper&) = delete;
+    PerfSampleHelper& operator=(const PerfSampleHelper&) = delete;
+};
+
+/**
+ * @brief Per node result of the sampling profiler
+ */
+struct SampledPerfRecord {
+    enum class Category : uint8_t { Compute, Reorder, Convert };
+
+    std::string node_name;
+    std::string node_type;
+    Category category = Category::Compute;
+    PerfHistogram histogram;
+};
+
 }  // namespace ov::intel_cpu
 
 #define GET_PERF(_node)    std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter()))
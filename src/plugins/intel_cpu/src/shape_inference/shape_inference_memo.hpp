@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <common/utils.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Shape inference decorator which memoizes the results of the wrapped implementation by the input shapes signature.
+ * Dynamic models usually see a limited set of input shapes (e.g. sequence lengths), so the shape inference of a
+ * repeated signature turns into a cache lookup. Only applicable to the implementations which don't depend on the
+ * input data, i.e. with the empty port mask.
+ *
+ */
+class MemoizedShapeInfer final : public IShapeInfer {
+public:
+    MemoizedShapeInfer(ShapeInferPtr shapeInfer, size_t capacity)
+        : m_shapeInfer(std::move(shapeInfer)),
+          m_cache(capacity) {
+        OPENVINO_ASSERT(m_shapeInfer && m_shapeInfer->get_port_mask() == EMPTY_PORT_MASK,
+                        "MemoizedShapeInfer supports only data independent shape inference");
+    }
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        Key key{{input_shapes.begin(), input_shapes.end()}};
+        if (auto entry = m_cache.get(key)) {
+            m_padsBegin = entry->padsBegin;
+            m_padsEnd = entry->padsEnd;
+            return {entry->dims, ShapeInferStatus::success};
+        }
+
+        auto result = m_shapeInfer->infer(input_shapes, data_dependency);
+        m_padsBegin = m_shapeInfer->get_pads_begin();
+        m_padsEnd = m_shapeInfer->get_pads_end();
+        if (ShapeInferStatus::success == result.status) {
+            m_cache.put(key, std::make_shared<const Entry>(Entry{result.dims, m_padsBegin, m_padsEnd}));
+        }
+        return result;
+    }
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return m_padsBegin;
+    }
+
+    const ov::CoordinateDiff& get_pads_end() override {
+        return m_padsEnd;
+    }
+
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    struct Key {
+        std::vector<VectorDims> dims;
+
+        [[nodiscard]] size_t hash() const {
+            size_t seed = dims.size();
+            for (const auto& shape : dims) {
+                seed = dnnl::impl::hash_combine(seed, shape.size());
+                for (const auto dim : shape) {
+                    seed = dnnl::impl::hash_combine(seed, dim);
+                }
+            }
+            return seed;
+        }
+
+        bool operator==(const Key& rhs) const {
+            return dims == rhs.dims;
+        }
+    };
+
+    struct Entry {
+        std::vector<VectorDims> dims;
+        ov::CoordinateDiff padsBegin;
+        ov::CoordinateDiff padsEnd;
+    };
+
+    ShapeInferPtr m_shapeInfer;
+    LruCache<Key, std::shared_ptr<const Entry>> m_cache;
+    ov::CoordinateDiff m_padsBegin;
+    ov::CoordinateDiff m_padsEnd;
+};
+
+}  // namespace ov::intel_cpu
@@ -6,9 +6,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/transpose.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -96,6 +106,169 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetROPropertiesThrow) {
     }
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSamplingProfilerCanBeToggledAtRuntime) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::profiling_sampling_interval), 0u);
+
+    auto inferRequest = compiledModel.create_infer_request();
+    OV_ASSERT_NO_THROW(inferRequest.infer());
+    std::string report;
+    OV_ASSERT_NO_THROW(report = compiledModel.get_property(ov::intel_cpu::profiling_report));
+    // nothing has been sampled, so the report holds the headers and zero category totals only
+    ASSERT_EQ(report, "node,type,samples,mean_us,p50_us,p90_us,p99_us\ncategory,total_us\ncompute,0\nreorder,0\nconvert,0\n");
+
+    OV_ASSERT_NO_THROW(compiledModel.set_property({ov::intel_cpu::profiling_sampling_interval(2)}));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::profiling_sampling_interval), 2u);
+    for (size_t i = 0; i < 4; i++) {
+        OV_ASSERT_NO_THROW(inferRequest.infer());
+    }
+
+    OV_ASSERT_NO_THROW(report = compiledModel.get_property(ov::intel_cpu::profiling_report));
+    std::istringstream lines(report);
+    std::string line;
+    std::getline(lines, line);
+    ASSERT_EQ(line, "node,type,samples,mean_us,p50_us,p90_us,p99_us");
+    size_t sampledNodes = 0;
+    while (std::getline(lines, line) && line != "category,total_us") {
+        ASSERT_NE(line.find(",2,"), std::string::npos) << line;
+        sampledNodes++;
+    }
+    ASSERT_GT(sampledNodes, 0u);
+
+    // other properties are still read only
+    ASSERT_THROW(compiledModel.set_property({ov::enable_profiling(true)}), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeBuckets) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    ov::CompiledModel compiledModel =
+        ie.compile_model(dynamicModel, deviceName, ov::intel_cpu::shape_buckets(std::vector<int64_t>{8, 4}));
+    auto inferRequest = compiledModel.create_infer_request();
+
+    for (const size_t length : {3, 8, 10}) {
+        ov::Tensor input(ov::element::f32, {1, length});
+        for (size_t i = 0; i < length; i++) {
+            input.data<float>()[i] = (i % 2) ? static_cast<float>(i) : -static_cast<float>(i);
+        }
+        inferRequest.set_input_tensor(input);
+        OV_ASSERT_NO_THROW(inferRequest.infer());
+
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{1, length}));
+        for (size_t i = 0; i < length; i++) {
+            ASSERT_EQ(output.data<float>()[i], (i % 2) ? static_cast<float>(i) : 0.f);
+        }
+    }
+
+    std::map<std::string, uint64_t> statistics;
+    OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::shape_bucket_statistics));
+    const std::map<std::string, uint64_t> expected{{"4", 1}, {"8", 1}, {"dynamic", 1}};
+    ASSERT_EQ(statistics, expected);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeBucketsSliceEqualOutputDims) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 0});
+    auto transpose = std::make_shared<ov::op::v1::Transpose>(relu, order);
+    // [L, 1] x [1, L], both dimensions of the output are equal to the bucketed one
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(transpose, relu);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{relu, matmul}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    ov::CompiledModel compiledModel =
+        ie.compile_model(dynamicModel, deviceName, ov::intel_cpu::shape_buckets(std::vector<int64_t>{4}));
+    auto inferRequest = compiledModel.create_infer_request();
+
+    for (const size_t length : {3, 4}) {
+        ov::Tensor input(ov::element::f32, {1, length});
+        for (size_t i = 0; i < length; i++) {
+            input.data<float>()[i] = static_cast<float>(i + 1);
+        }
+        inferRequest.set_input_tensor(input);
+        OV_ASSERT_NO_THROW(inferRequest.infer());
+
+        const auto output = inferRequest.get_output_tensor(1);
+        ASSERT_EQ(output.get_shape(), (ov::Shape{length, length}));
+        for (size_t i = 0; i < length; i++) {
+            for (size_t j = 0; j < length; j++) {
+                ASSERT_EQ(output.data<float>()[i * length + j], static_cast<float>((i + 1) * (j + 1)));
+            }
+        }
+    }
+
+    std::map<std::string, uint64_t> statistics;
+    OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::shape_bucket_statistics));
+    const std::map<std::string, uint64_t> expected{{"4", 2}, {"dynamic", 0}};
+    ASSERT_EQ(statistics, expected);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeBucketsNotBuiltForOtherDynamicDims) {
+    // the batch is dynamic as well, so the reshaped variants would not be static
+    auto batchParam = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1});
+    auto batchModel = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Relu>(batchParam)},
+                                                  ov::ParameterVector{batchParam});
+    // the output dimension is twice as large as the bucketed one, the padded positions are in the middle of it
+    auto concatParam = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{concatParam, concatParam}, 1);
+    auto concatModel = std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{concatParam});
+
+    ov::Core ie;
+    for (const auto& model : {batchModel, concatModel}) {
+        ov::CompiledModel compiledModel =
+            ie.compile_model(model, deviceName, ov::intel_cpu::shape_buckets(std::vector<int64_t>{4}));
+        auto inferRequest = compiledModel.create_infer_request();
+
+        ov::Tensor input(ov::element::f32, {1, 3});
+        for (size_t i = 0; i < 3; i++) {
+            input.data<float>()[i] = static_cast<float>(i + 1);
+        }
+        inferRequest.set_input_tensor(input);
+        OV_ASSERT_NO_THROW(inferRequest.infer());
+
+        const auto output = inferRequest.get_output_tensor();
+        const size_t outputSize = model == concatModel ? 6 : 3;
+        ASSERT_EQ(output.get_shape(), (ov::Shape{1, outputSize}));
+        for (size_t i = 0; i < outputSize; i++) {
+            ASSERT_EQ(output.data<float>()[i], static_cast<float>(i % 3 + 1));
+        }
+
+        std::map<std::string, uint64_t> statistics;
+        OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::shape_bucket_statistics));
+        ASSERT_EQ(statistics.count("4"), 0);
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkShapeBucketsKeptByExport) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    std::stringstream blob;
+    ie.compile_model(dynamicModel, deviceName, ov::intel_cpu::shape_buckets(std::vector<int64_t>{4}))
+        .export_model(blob);
+    ov::CompiledModel importedModel;
+    OV_ASSERT_NO_THROW(importedModel = ie.import_model(blob, deviceName));
+    auto inferRequest = importedModel.create_infer_request();
+
+    ov::Tensor input(ov::element::f32, {1, 3});
+    std::fill_n(input.data<float>(), 3, -1.f);
+    inferRequest.set_input_tensor(input);
+    OV_ASSERT_NO_THROW(inferRequest.infer());
+    ASSERT_EQ(inferRequest.get_output_tensor().get_shape(), (ov::Shape{1, 3}));
+
+    std::map<std::string, uint64_t> statistics;
+    OV_ASSERT_NO_THROW(statistics = importedModel.get_property(ov::intel_cpu::shape_bucket_statistics));
+    const std::map<std::string, uint64_t> expected{{"4", 1}, {"dynamic", 0}};
+    ASSERT_EQ(statistics, expected);
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCoreStreamsHasHigherPriorityThanThroughputHint) {
     ov::Core ie;
     int32_t streams = 1;  // throughput hint should apply higher number of streams
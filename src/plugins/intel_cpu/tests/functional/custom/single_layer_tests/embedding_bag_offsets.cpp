@@ -55,7 +55,11 @@ public:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex, reduction] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        if (inType == ElementType::bf16 || inType == ElementType::f16) {
+            // the table is read in its own precision only if it is not converted to f32 by the plugin
+            configuration.insert({ov::hint::inference_precision.name(), inType});
+        }
+        selectedType = makeSelectedTypeStr("ref", deduce_expected_precision(inType, configuration));
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -125,6 +129,16 @@ const std::vector<std::vector<size_t>> indices = {{0, 1, 2, 2, 3}, {4, 4, 3, 1,
 const std::vector<std::vector<size_t>> offsets = {{0, 2}, {0, 0, 2, 2}, {2, 4}};
 const std::vector<size_t> default_index = {0, 4};
 const std::vector<bool> with_default_index = {false, true};
+// the table precisions read by the vectorized kernel
+const std::vector<ElementType> floatTablePrecisions = {ElementType::f32, ElementType::bf16, ElementType::f16};
+
+// the row depths are not multiples of the vector length, so the vector tiles are followed by the scalar tail
+const std::vector<InputShape> input_shapes_odd_depth = {
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 37}, {10, 83}}},
+    {{10, 83}, {{10, 83}}},
+    {{5, 3, 29}, {{5, 3, 29}}},
+};
+
 const std::vector<ov::op::util::EmbeddingBagOffsetsBase::Reduction> reduction = {
     ov::op::util::EmbeddingBagOffsetsBase::Reduction::SUM,
     ov::op::util::EmbeddingBagOffsetsBase::Reduction::MEAN};
@@ -157,6 +171,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagOffsets_No_Weights,
                                             ::testing::ValuesIn(indPrecisions),
                                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          EmbeddingBagOffsetsLayerCPUTest::getTestCaseName);
+const auto embBagOffsetArgSetOddDepthWthWeights =
+    ::testing::Combine(::testing::ValuesIn(input_shapes_odd_depth),
+                       ::testing::ValuesIn(indices),
+                       ::testing::Values(std::vector<size_t>{0, 0, 2, 2}),
+                       ::testing::Values(4),
+                       ::testing::Values(true),
+                       ::testing::ValuesIn(with_default_index),
+                       ::testing::Values(ov::op::util::EmbeddingBagOffsetsBase::Reduction::SUM));
+const auto embBagOffsetArgSetOddDepthNoWeights =
+    ::testing::Combine(::testing::ValuesIn(input_shapes_odd_depth),
+                       ::testing::ValuesIn(indices),
+                       ::testing::Values(std::vector<size_t>{0, 0, 2, 2}),
+                       ::testing::Values(4),
+                       ::testing::Values(false),
+                       ::testing::ValuesIn(with_default_index),
+                       ::testing::ValuesIn(reduction));
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagOffsets_Float_Table_With_Weights,
+                         EmbeddingBagOffsetsLayerCPUTest,
+                         ::testing::Combine(embBagOffsetArgSetOddDepthWthWeights,
+                                            ::testing::ValuesIn(floatTablePrecisions),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingBagOffsetsLayerCPUTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagOffsets_Float_Table_No_Weights,
+                         EmbeddingBagOffsetsLayerCPUTest,
+                         ::testing::Combine(embBagOffsetArgSetOddDepthNoWeights,
+                                            ::testing::ValuesIn(floatTablePrecisions),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingBagOffsetsLayerCPUTest::getTestCaseName);
 
 const auto embBagOffsetArgSetNegative = ::testing::Combine(
     ::testing::Values(InputShape{{5, 6}, {{5, 6}}}),
@@ -51,7 +51,11 @@ protected:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, withWeights, reduction] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        if (inType == ElementType::bf16 || inType == ElementType::f16) {
+            // the table is read in its own precision only if it is not converted to f32 by the plugin
+            configuration.insert({ov::hint::inference_precision.name(), inType});
+        }
+        selectedType = makeSelectedTypeStr("ref", deduce_expected_precision(inType, configuration));
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -106,6 +110,16 @@ const std::vector<std::vector<std::vector<size_t>>> indices = {{{0, 1}, {2, 2},
                                                                {{4, 4, 3}, {1, 0, 2}},
                                                                {{1, 2, 1, 2}, {1, 2, 1, 2}}};
 
+// the table precisions read by the vectorized kernel
+const std::vector<ElementType> floatTablePrecisions = {ElementType::f32, ElementType::bf16, ElementType::f16};
+
+// the row depths are not multiples of the vector length, so the vector tiles are followed by the scalar tail
+const std::vector<InputShape> input_shapes_odd_depth = {
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 37}, {10, 83}}},
+    {{10, 83}, {{10, 83}}},
+    {{5, 3, 29}, {{5, 3, 29}}},
+};
+
 const std::vector<ov::op::util::EmbeddingBagPackedBase::Reduction> reduction = {
     ov::op::util::EmbeddingBagPackedBase::Reduction::SUM,
     ov::op::util::EmbeddingBagPackedBase::Reduction::MEAN};
@@ -134,6 +148,30 @@ INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagPacked_No_Weights,
                                             ::testing::ValuesIn(indPrecisions),
                                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          EmbeddingBagPackedLayerCPUTest::getTestCaseName);
+
+const auto embBagPackedArgSetOddDepthWthWeights =
+    ::testing::Combine(::testing::ValuesIn(input_shapes_odd_depth),
+                       ::testing::ValuesIn(indices),
+                       ::testing::Values(true),
+                       ::testing::Values(ov::op::util::EmbeddingBagPackedBase::Reduction::SUM));
+const auto embBagPackedArgSetOddDepthNoWeights = ::testing::Combine(::testing::ValuesIn(input_shapes_odd_depth),
+                                                                    ::testing::ValuesIn(indices),
+                                                                    ::testing::Values(false),
+                                                                    ::testing::ValuesIn(reduction));
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagPacked_Float_Table_With_Weights,
+                         EmbeddingBagPackedLayerCPUTest,
+                         ::testing::Combine(embBagPackedArgSetOddDepthWthWeights,
+                                            ::testing::ValuesIn(floatTablePrecisions),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingBagPackedLayerCPUTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagPacked_Float_Table_No_Weights,
+                         EmbeddingBagPackedLayerCPUTest,
+                         ::testing::Combine(embBagPackedArgSetOddDepthNoWeights,
+                                            ::testing::ValuesIn(floatTablePrecisions),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingBagPackedLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
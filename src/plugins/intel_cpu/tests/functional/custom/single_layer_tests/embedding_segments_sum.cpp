@@ -56,7 +56,11 @@ protected:
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex] =
             embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        if (inType == ElementType::bf16 || inType == ElementType::f16) {
+            // the table is read in its own precision only if it is not converted to f32 by the plugin
+            configuration.insert({ov::hint::inference_precision.name(), inType});
+        }
+        selectedType = makeSelectedTypeStr("ref", deduce_expected_precision(inType, configuration));
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -109,6 +113,16 @@ const std::vector<InputShape> input_shapes = {
     {{5, 4, 16}, {{5, 4, 16}}},
 };
 
+// the table precisions read by the vectorized kernel
+const std::vector<ElementType> floatTablePrecisions = {ElementType::f32, ElementType::bf16, ElementType::f16};
+
+// the row depths are not multiples of the vector length, so the vector tiles are followed by the scalar tail
+const std::vector<InputShape> input_shapes_odd_depth = {
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 37}, {10, 83}}},
+    {{10, 83}, {{10, 83}}},
+    {{5, 3, 29}, {{5, 3, 29}}},
+};
+
 const std::vector<std::vector<size_t>> indices = {{0, 1, 2, 2, 3}, {4, 4, 3, 1, 2}};
 const std::vector<std::vector<size_t>> segment_ids = {{0, 1, 2, 3, 4}, {0, 0, 2, 2, 4}};
 const std::vector<size_t> num_segments = {5, 7};
@@ -131,6 +145,22 @@ INSTANTIATE_TEST_SUITE_P(smoke,
                                             ::testing::ValuesIn(indPrecisions),
                                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+const auto embSegmentsSumArgSetOddDepth = ::testing::Combine(::testing::ValuesIn(input_shapes_odd_depth),
+                                                             ::testing::ValuesIn(indices),
+                                                             ::testing::ValuesIn(segment_ids),
+                                                             ::testing::Values(7),
+                                                             ::testing::Values(4),
+                                                             ::testing::ValuesIn(with_weights),
+                                                             ::testing::ValuesIn(with_default_index));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Float_Table,
+                         EmbeddingSegmentsSumLayerCPUTest,
+                         ::testing::Combine(embSegmentsSumArgSetOddDepth,
+                                            ::testing::ValuesIn(floatTablePrecisions),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -225,6 +225,19 @@ INSTANTIATE_TEST_SUITE_P(nightly_static,
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
 
+// the flattened inputs large enough to be partitioned and grouped in parallel
+INSTANTIATE_TEST_SUITE_P(smoke_static_large,
+                         UniqueLayerTestCPU,
+                         ::testing::Combine(::testing::ValuesIn(std::vector<std::vector<InputShape>>{
+                                                {{{}, {{64, 128, 16}}}},
+                                                {{{}, {{3, 100000}}}}}),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
 const std::vector<std::vector<InputShape>> dynamicInSapes = {
     {{{ov::Dimension(1, 15), -1, -1, -1},                             // Dynamic shape
       {{1, 1, 1, 1}, {6, 3, 1, 2}, {4, 5, 3, 1}, {2, 7, 2, 2}}}},     // Target shapes
@@ -9,6 +9,7 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -283,6 +284,133 @@ protected:
     static constexpr size_t num_channels = 64ul;
 };
 
+// Multi-adapter LoRA: the states stack several adapters and every batch item selects its adapter by index
+class LoraPatternAdapterSelectionCPUTest : public SubgraphBaseTest {
+protected:
+    // transposed_input == true builds the same computation over the transposed activations, the LoRA node doesn't
+    // recognize such a body as the adapter selection and runs its inner graph
+    std::shared_ptr<ov::Model> build_model(bool transposed_input) {
+        ov::PartialShape shape_x = transposed_input ? ov::PartialShape{-1, K, -1} : ov::PartialShape{-1, -1, K};
+        auto param_x = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape{N, K});
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_x, param_w, transposed_input, true);
+
+        ov::OutputVector selected_states;
+        ov::SinkVector assigns;
+        const std::vector<ov::PartialShape> state_shapes{{-1, N, -1}, {-1, 1, -1}, {-1, -1, K}};
+        const std::vector<std::string> state_names{t4_name, t5_name, t6_name};
+        for (size_t i = 0; i < state_shapes.size(); ++i) {
+            auto variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{state_shapes[i], netType, state_names[i]});
+            auto read_value = std::make_shared<ov::op::v6::ReadValue>(variable);
+            assigns.push_back(std::make_shared<ov::op::v6::Assign>(read_value, variable));
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            selected_states.push_back(std::make_shared<ov::op::v8::Gather>(read_value, param_indices, axis));
+        }
+
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_x, selected_states[2], transposed_input, true);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, selected_states[1]);
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, selected_states[0], false, true);
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(tz)},
+                                           assigns,
+                                           ov::ParameterVector{param_x, param_w, param_indices});
+    }
+
+    static void set_states(ov::InferRequest& request, const std::vector<ov::Tensor>& states) {
+        for (auto&& state : request.query_state()) {
+            const auto& name = state.get_name();
+            state.set_state(name == t4_name ? states[0] : name == t5_name ? states[1] : states[2]);
+        }
+    }
+
+    static std::vector<ov::Tensor> generate_states(size_t adapters, int seed) {
+        using ov::test::utils::InputGenerateData;
+        // integer values keep the results exact regardless of the accumulation order
+        using ov::test::utils::create_and_fill_tensor;
+        return {create_and_fill_tensor(netType, {adapters, N, rank}, InputGenerateData{-2, 4, 1, seed}),
+                create_and_fill_tensor(netType, {adapters, 1, rank}, InputGenerateData{-1, 3, 1, seed}),
+                create_and_fill_tensor(netType, {adapters, rank, K}, InputGenerateData{-2, 4, 1, seed})};
+    }
+
+    static constexpr size_t K = 67ul;
+    static constexpr size_t N = 96ul;
+    static constexpr size_t rank = 8ul;
+    static constexpr size_t batch = 5ul;
+    static constexpr size_t rows = 7ul;
+};
+
+TEST_F(LoraPatternAdapterSelectionCPUTest, CompareWithInnerGraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    targetDevice = ov::test::utils::DEVICE_CPU;
+
+    function = build_model(false);
+    auto fallback_function = build_model(true);
+    compiledModel = core->compile_model(function, targetDevice);
+    auto fallback_compiled_model = core->compile_model(fallback_function, targetDevice);
+    CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CheckNumberOfNodesWithType(fallback_compiled_model, "LoRA", 1);
+    inferRequest = compiledModel.create_infer_request();
+    auto fallback_request = fallback_compiled_model.create_infer_request();
+    auto reference_request = core->compile_model(function, ov::test::utils::DEVICE_TEMPLATE).create_infer_request();
+
+    using ov::test::utils::InputGenerateData;
+    auto x = ov::test::utils::create_and_fill_tensor(netType, {batch, rows, K}, InputGenerateData{-2, 4, 1, 1});
+    auto x_transposed = ov::Tensor(netType, {batch, K, rows});
+    for (size_t b = 0; b < batch; ++b) {
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t k = 0; k < K; ++k) {
+                x_transposed.data<float>()[(b * K + k) * rows + r] = x.data<float>()[(b * rows + r) * K + k];
+            }
+        }
+    }
+    auto w = ov::test::utils::create_and_fill_tensor(netType, {N, K}, InputGenerateData{-2, 4, 1, 2});
+    for (auto* request : {&inferRequest, &reference_request}) {
+        request->set_tensor(function->input(0), x);
+        request->set_tensor(function->input(1), w);
+    }
+    fallback_request.set_tensor(fallback_function->input(0), x_transposed);
+    fallback_request.set_tensor(fallback_function->input(1), w);
+
+    auto infer_and_compare = [&](const std::vector<int32_t>& adapter_indices) {
+        ov::Tensor indices(ov::element::i32, {adapter_indices.size()});
+        std::copy(adapter_indices.begin(), adapter_indices.end(), indices.data<int32_t>());
+        for (auto* request : {&inferRequest, &fallback_request, &reference_request}) {
+            request->set_tensor(request->get_compiled_model().input(2), indices);
+            request->infer();
+        }
+        const auto result = inferRequest.get_output_tensor(0);
+        ov::test::utils::compare(fallback_request.get_output_tensor(0), result, 1e-4, 1e-4);
+        ov::test::utils::compare(reference_request.get_output_tensor(0), result, 1e-4, 1e-4);
+    };
+
+    // the adapters are added and removed by the states stacking a different number of them
+    int seed = 3;
+    for (const size_t adapters : {3ul, 1ul, 4ul}) {
+        const auto states = generate_states(adapters, seed++);
+        for (auto* request : {&inferRequest, &fallback_request, &reference_request}) {
+            set_states(*request, states);
+        }
+        const auto last = static_cast<int32_t>(adapters - 1);
+        // mixed per-row adapters, including a negative index counted from the end
+        infer_and_compare({last, 0, last, -1, 0});
+        infer_and_compare({0, 0, 0, 0, 0});
+        infer_and_compare({last, -static_cast<int32_t>(adapters), 0, last, 0});
+    }
+
+    // the indices out of the loaded adapters are rejected
+    for (const int32_t index : {4, -5}) {
+        ov::Tensor indices(ov::element::i32, {batch});
+        std::fill_n(indices.data<int32_t>(), batch, 0);
+        indices.data<int32_t>()[batch - 1] = index;
+        inferRequest.set_tensor(function->input(2), indices);
+        EXPECT_THROW(inferRequest.infer(), ov::Exception);
+    }
+}
+
 TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     targetStaticShapes = {{{{1, 20, K}}, {{N, K}}}};
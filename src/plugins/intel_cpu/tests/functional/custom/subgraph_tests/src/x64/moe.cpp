@@ -10,6 +10,7 @@
 
 #include "common_test_utils/node_builders/moe_builders.hpp"
 #include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
+#include "internal_properties.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "shared_test_classes/subgraph/weights_decompression_params.hpp"
 #include "utils/cpu_test_utils.hpp"
@@ -171,6 +172,20 @@ protected:
         const auto& gather_mm_nodes = get_gather_mm_nodes(compiledModel.get_runtime_model(), moe_type);
         const size_t expected_gather_mm_count = get_expected_gather_mm_count(moe_type);
         EXPECT_EQ(gather_mm_nodes.size(), expected_gather_mm_count);
+
+        auto itr = configuration.find(ov::intel_cpu::moe_expert_cache_size.name());
+        if (itr != configuration.end()) {
+            const auto budget = itr->second.as<uint64_t>();
+            const auto statistics = compiledModel.get_property(ov::intel_cpu::moe_expert_cache_statistics);
+            EXPECT_GT(statistics.at("misses"), 0u);
+            EXPECT_GT(statistics.at("resident_experts"), 0u);
+            // the most recently used expert is never evicted, so only a single expert may exceed the budget
+            if (statistics.at("resident_experts") > 1) {
+                EXPECT_LE(statistics.at("resident_bytes"), budget);
+            }
+            // the inference is over, so no evicted expert is held anymore
+            EXPECT_EQ(statistics.at("pinned_bytes"), 0u);
+        }
     }
 };
 
@@ -335,6 +350,22 @@ const std::vector<MoeTestShapeParams> moe_params_smoke = {
     },
 };
 
+// few experts for many tokens, so every routed expert gets many rows and the rows are applied by the grouped GEMM
+const std::vector<MoeTestShapeParams> moe_params_skewed_routing = {
+    {
+        {{-1, -1, 128}, {{1, 40, 128}, {2, 17, 128}, {1, 1, 128}}},  // data_shape
+        2,                                                            // topk
+        2,                                                            // number_of_experts
+        256                                                           // intermediate_size
+    },
+    {
+        {{-1, -1, 64}, {{1, 33, 64}, {3, 5, 64}}},  // data_shape
+        1,                                          // topk
+        3,                                          // number_of_experts
+        128                                         // intermediate_size
+    },
+};
+
 std::vector<ov::AnyMap> generate_additional_config() {
     std::vector<ov::AnyMap> additional_config = {{{ov::hint::inference_precision.name(), ov::element::f32}}};
     if (ov::with_cpu_x86_bfloat16()) {
@@ -361,6 +392,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_3gemm_gelu,
                                             ::testing::ValuesIn(generate_additional_config())),
                          MoESubgraphTest::getTestCaseName);
 
+// the budget fits a couple of experts only, so the experts are evicted and packed again during the inference
+INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_expert_paging,
+                         MoESubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
+                                            ::testing::ValuesIn(moe_types),
+                                            ::testing::Values(MoEActivationType::SWISH),
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::hint::inference_precision.name(), ov::element::f32},
+                                                {ov::intel_cpu::moe_expert_cache_size.name(), uint64_t{1024 * 1024}}})),
+                         MoESubgraphTest::getTestCaseName);
+
+// f32 inference precision never takes the AMX path, the GEMM or its GEMV fallback runs on the other ISAs
+INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_skewed_routing,
+                         MoESubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_skewed_routing),
+                                            ::testing::ValuesIn(moe_types),
+                                            ::testing::Values(MoEActivationType::SWISH),
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::hint::inference_precision.name(), ov::element::f32}})),
+                         MoESubgraphTest::getTestCaseName);
+
 const std::vector<ov::test::ElementType> decompression_precisions = {ov::element::f32};
 const std::vector<ov::test::ElementType> weights_precisions = {ov::element::u8,
                                                                ov::element::i8,
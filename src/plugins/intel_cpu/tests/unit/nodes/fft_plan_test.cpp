@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/fft_plan.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr double PI = 3.141592653589793238462643;
+
+using FFTPlanTestParams = std::tuple<size_t, bool>;
+
+class FFTPlanTest : public ::testing::TestWithParam<FFTPlanTestParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<FFTPlanTestParams>& obj) {
+        const auto& [n, inverse] = obj.param;
+        return "n=" + std::to_string(n) + "_inverse=" + std::to_string(inverse);
+    }
+};
+
+TEST_P(FFTPlanTest, MatchesNaiveDFT) {
+    const auto& [n, inverse] = GetParam();
+    std::vector<float> data(2 * n);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = std::sin(0.37F * static_cast<float>(i)) + static_cast<float>(i % 7) * 0.1F;
+    }
+
+    std::vector<std::complex<double>> expected(n);
+    const double sign = inverse ? 2.0 : -2.0;
+    for (size_t k = 0; k < n; k++) {
+        for (size_t j = 0; j < n; j++) {
+            const double angle = sign * PI * static_cast<double>((j * k) % n) / static_cast<double>(n);
+            expected[k] += std::complex<double>(data[2 * j], data[2 * j + 1]) * std::polar(1.0, angle);
+        }
+        if (inverse) {
+            expected[k] /= static_cast<double>(n);
+        }
+    }
+
+    const auto plan = FFTPlan::get(n, inverse);
+    ASSERT_EQ(plan, FFTPlan::get(n, inverse));
+    std::vector<float> scratch(plan->getScratchSize());
+    plan->execute(data.data(), scratch.data());
+
+    for (size_t k = 0; k < n; k++) {
+        EXPECT_NEAR(data[2 * k], expected[k].real(), 1e-3) << "k=" << k;
+        EXPECT_NEAR(data[2 * k + 1], expected[k].imag(), 1e-3) << "k=" << k;
+    }
+}
+
+// mixed radix lengths (STFT frame sizes among them) and prime lengths served by Bluestein
+INSTANTIATE_TEST_SUITE_P(smoke_FFTPlan,
+                         FFTPlanTest,
+                         ::testing::Combine(::testing::Values(1, 6, 12, 49, 143, 400, 1000, 1500, 97, 1009),
+                                            ::testing::Bool()),
+                         FFTPlanTest::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "nodes/common/nms_utils.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+using NmsCandidatesTestParams = std::tuple<size_t,  // number of boxes
+                                           size_t,  // limit
+                                           bool>;   // inclusive threshold
+
+class NmsCandidatesTest : public ::testing::TestWithParam<NmsCandidatesTestParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<NmsCandidatesTestParams>& obj) {
+        const auto& [num, limit, inclusive] = obj.param;
+        const auto limitName = limit == static_cast<size_t>(-1) ? std::string("none") : std::to_string(limit);
+        return "num" + std::to_string(num) + "_limit" + limitName + (inclusive ? "_inclusive" : "_exclusive");
+    }
+};
+
+TEST_P(NmsCandidatesTest, MatchesFullSort) {
+    const auto& [num, limit, inclusive] = GetParam();
+    constexpr float threshold = 0.25F;
+
+    // coarse scores to get a lot of ties, including the ones equal to the threshold
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 40);
+    std::vector<float> scores(num);
+    for (auto& score : scores) {
+        score = static_cast<float>(dist(gen)) / 40.F;
+    }
+
+    std::vector<std::pair<float, int>> expected;
+    for (size_t i = 0; i < num; i++) {
+        if (inclusive ? scores[i] >= threshold : scores[i] > threshold) {
+            expected.emplace_back(scores[i], static_cast<int>(i));
+        }
+    }
+    std::sort(expected.begin(), expected.end(), [](const auto& l, const auto& r) {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    });
+    expected.resize(std::min(expected.size(), limit));
+
+    NmsCandidates candidates;
+    candidates.collect(scores.data(), num, threshold, inclusive, limit);
+    ASSERT_EQ(candidates.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(candidates[i], expected[i]) << "i=" << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsCandidates,
+                         NmsCandidatesTest,
+                         ::testing::Combine(::testing::Values(0, 1, 63, 64, 65, 1000, 100000),
+                                            ::testing::Values(static_cast<size_t>(-1), 10, 500),
+                                            ::testing::Bool()),
+                         NmsCandidatesTest::getTestCaseName);
+
+float referenceIoU(const float* boxI, const float* boxJ, float norm) {
+    const float areaI = (boxI[2] - boxI[0] + norm) * (boxI[3] - boxI[1] + norm);
+    const float areaJ = (boxJ[2] - boxJ[0] + norm) * (boxJ[3] - boxJ[1] + norm);
+    if (areaI <= 0.F || areaJ <= 0.F) {
+        return 0.F;
+    }
+    const float intersection = std::max(std::min(boxI[2], boxJ[2]) - std::max(boxI[0], boxJ[0]) + norm, 0.F) *
+                               std::max(std::min(boxI[3], boxJ[3]) - std::max(boxI[1], boxJ[1]) + norm, 0.F);
+    return intersection / (areaI + areaJ - intersection);
+}
+
+TEST(NmsSelectedBoxesTest, MatchesScalarGreedySuppression) {
+    constexpr size_t num = 2000;
+    constexpr float iouThreshold = 0.3F;
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> pos(0.F, 100.F);
+    std::uniform_real_distribution<float> size(-1.F, 15.F);  // a few degenerated boxes as well
+    std::vector<float> boxes(num * 4);
+    for (size_t i = 0; i < num; i++) {
+        boxes[i * 4] = pos(gen);
+        boxes[i * 4 + 1] = pos(gen);
+        boxes[i * 4 + 2] = boxes[i * 4] + size(gen);
+        boxes[i * 4 + 3] = boxes[i * 4 + 1] + size(gen);
+    }
+
+    for (const float norm : {0.F, 1.F}) {
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < num; i++) {
+            const bool suppressed = std::any_of(expected.begin(), expected.end(), [&](size_t j) {
+                return referenceIoU(&boxes[i * 4], &boxes[j * 4], norm) >= iouThreshold;
+            });
+            if (!suppressed) {
+                expected.push_back(i);
+            }
+        }
+
+        NmsSelectedBoxes selected(num, norm);
+        std::vector<size_t> actual;
+        for (size_t i = 0; i < num; i++) {
+            const float* box = &boxes[i * 4];
+            if (!selected.suppresses(box[0], box[1], box[2], box[3], iouThreshold)) {
+                selected.push(box[0], box[1], box[2], box[3]);
+                actual.push_back(i);
+            }
+        }
+        ASSERT_EQ(actual, expected) << "norm=" << norm;
+        ASSERT_EQ(selected.size(), expected.size());
+    }
+}
+
+TEST(NmsSelectedBoxesTest, DegeneratedBoxesWithZeroThreshold) {
+    // IoU of a degenerated box is 0, which still reaches the zero threshold, so only the first box is selected
+    const std::vector<std::vector<float>> boxes = {{5.F, 5.F, 5.F, 5.F},
+                                                   {0.F, 0.F, 1.F, 1.F},
+                                                   {2.F, 2.F, 1.F, 3.F},
+                                                   {10.F, 10.F, 11.F, 11.F}};
+    for (const float iouThreshold : {0.F, 0.5F}) {
+        NmsSelectedBoxes selected(boxes.size());
+        for (const auto& box : boxes) {
+            if (!selected.suppresses(box[0], box[1], box[2], box[3], iouThreshold)) {
+                selected.push(box[0], box[1], box[2], box[3]);
+            }
+        }
+        ASSERT_EQ(selected.size(), iouThreshold == 0.F ? 1U : boxes.size()) << "iouThreshold=" << iouThreshold;
+    }
+}
+
+}  // namespace
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "nodes/common/unique_utils.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+using UniqueUtilsTestParams = std::tuple<size_t,   // number of elements
+                                         size_t>;  // number of distinct values
+
+class GroupUniqueElementsTest : public ::testing::TestWithParam<UniqueUtilsTestParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<UniqueUtilsTestParams>& obj) {
+        const auto& [len, distinct] = obj.param;
+        return "len" + std::to_string(len) + "_distinct" + std::to_string(distinct);
+    }
+};
+
+template <typename T>
+void checkGroups(const std::vector<T>& src) {
+    // the hash map reference, NaN is never found in it like in the operation
+    std::unordered_multimap<T, int32_t> groups;
+    std::vector<int32_t> expectedGroupOf(src.size());
+    std::vector<int32_t> expectedFirsts;
+    std::vector<int32_t> expectedCounts;
+    for (size_t i = 0; i < src.size(); i++) {
+        auto it = groups.find(src[i]);
+        if (it == groups.end()) {
+            it = groups.emplace(src[i], static_cast<int32_t>(expectedFirsts.size()));
+            expectedFirsts.push_back(static_cast<int32_t>(i));
+            expectedCounts.push_back(0);
+        }
+        expectedCounts[it->second]++;
+        expectedGroupOf[i] = it->second;
+    }
+
+    std::vector<int32_t> groupOf(src.size());
+    std::vector<int32_t> firsts;
+    std::vector<int32_t> counts;
+    const auto groupsNum = groupUniqueElements(src.data(), src.size(), groupOf.data(), firsts, counts);
+    ASSERT_EQ(groupsNum, expectedFirsts.size());
+    ASSERT_EQ(firsts, expectedFirsts);
+    ASSERT_EQ(counts, expectedCounts);
+    ASSERT_EQ(groupOf, expectedGroupOf);
+}
+
+TEST_P(GroupUniqueElementsTest, MatchesFirstOccurrenceGrouping) {
+    const auto& [len, distinct] = GetParam();
+
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int32_t> dist(0, static_cast<int32_t>(distinct) - 1);
+    std::vector<int32_t> intData(len);
+    std::vector<float> floatData(len);
+    for (size_t i = 0; i < len; i++) {
+        intData[i] = dist(gen) * 7919 - 1000;
+        floatData[i] = static_cast<float>(intData[i]) / 8.F;
+    }
+    checkGroups(intData);
+    checkGroups(floatData);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GroupUniqueElements,
+                         GroupUniqueElementsTest,
+                         ::testing::Combine(::testing::Values(0, 1, 1000, 70000, 200000),
+                                            ::testing::Values(1, 300, 5000)),
+                         GroupUniqueElementsTest::getTestCaseName);
+
+TEST(GroupUniqueElementsTest, SignedZerosAndNaN) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (const size_t len : {10, 100000}) {
+        std::vector<float> src(len);
+        for (size_t i = 0; i < len; i++) {
+            src[i] = i % 5 == 0 ? -0.F : (i % 5 == 1 ? 0.F : (i % 1000 == 2 ? nan : static_cast<float>(i % 50)));
+        }
+        checkGroups(src);
+    }
+}
+
+TEST(GroupUniqueElementsTest, SmallTypes) {
+    std::mt19937 gen(5);
+    std::vector<int8_t> i8(100000);
+    std::vector<uint8_t> u8(100000);
+    for (size_t i = 0; i < i8.size(); i++) {
+        i8[i] = static_cast<int8_t>(gen());
+        u8[i] = static_cast<uint8_t>(gen());
+    }
+    checkGroups(i8);
+    checkGroups(u8);
+}
+
+}  // namespace
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "shape_inference/shape_inference_memo.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class CountingShapeInfer final : public IShapeInfer {
+public:
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>&) override {
+        calls++;
+        auto dims = input_shapes.front().get();
+        dims.back() *= 2;
+        pads = {static_cast<std::ptrdiff_t>(dims.back())};
+        return {{dims}, ShapeInferStatus::success};
+    }
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return pads;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return pads;
+    }
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+    size_t calls = 0;
+    ov::CoordinateDiff pads;
+};
+
+IShapeInfer::Result infer(IShapeInfer& shapeInfer, const VectorDims& dims) {
+    return shapeInfer.infer({std::cref(dims)}, {});
+}
+
+}  // namespace
+
+TEST(MemoizedShapeInferTest, RepeatedSignatureHitsCache) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    MemoizedShapeInfer memo(counting, 2);
+
+    const VectorDims first{1, 8};
+    const VectorDims second{1, 16};
+
+    ASSERT_EQ(infer(memo, first).dims, std::vector<VectorDims>{VectorDims({1, 16})});
+    ASSERT_EQ(infer(memo, second).dims, std::vector<VectorDims>{VectorDims({1, 32})});
+    ASSERT_EQ(counting->calls, 2u);
+
+    // the signatures are alternated, but both are served from the cache together with the pads
+    ASSERT_EQ(infer(memo, first).dims, std::vector<VectorDims>{VectorDims({1, 16})});
+    ASSERT_EQ(memo.get_pads_begin(), ov::CoordinateDiff{16});
+    ASSERT_EQ(infer(memo, second).dims, std::vector<VectorDims>{VectorDims({1, 32})});
+    ASSERT_EQ(memo.get_pads_end(), ov::CoordinateDiff{32});
+    ASSERT_EQ(counting->calls, 2u);
+
+    // the least recently used signature is evicted once the capacity is exceeded
+    (void)infer(memo, VectorDims{1, 4});
+    (void)infer(memo, first);
+    ASSERT_EQ(counting->calls, 4u);
+}
@@ -1354,6 +1354,35 @@ class TestPytorchConversionParams(CommonMOConvertTest):
                                 ref_model, compare_tensor_names=False)
 
 
+class TestPytorchConstantStatistics(unittest.TestCase):
+    @staticmethod
+    def convert(weight, **params):
+        from openvino.tools.ovc import convert_model
+
+        class NeuralNetwork(torch.nn.Module):
+            def __init__(self):
+                super(NeuralNetwork, self).__init__()
+                self.y = weight
+
+            def forward(self, x):
+                return x + self.y
+
+        ov_model = convert_model(NeuralNetwork(), example_input=(torch.zeros(weight.shape),), **params)
+        return (int(ov_model.get_rt_info(["conversion_statistics", "shared_constant_bytes"]).astype(str)),
+                int(ov_model.get_rt_info(["conversion_statistics", "copied_constant_bytes"]).astype(str)))
+
+    @pytest.mark.precommit
+    def test_shared_weights(self):
+        assert self.convert(torch.arange(12, dtype=torch.float32).reshape(3, 4)) == (12 * 4, 0)
+
+    @pytest.mark.precommit
+    def test_copied_weights(self):
+        weight = torch.arange(12, dtype=torch.float32).reshape(3, 4)
+        assert self.convert(weight, share_weights=False) == (0, 12 * 4)
+        # a non-contiguous tensor is copied even if the weights are shared
+        assert self.convert(weight.t()) == (0, 12 * 4)
+
+
 def pytorch_nn_module_with_enabled_compression(tmp_dir):
     import torch
 
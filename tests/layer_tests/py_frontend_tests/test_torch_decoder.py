@@ -184,6 +184,50 @@ def test_pytorch_decoder_can_convert_bf16_tensor():
     assert ov_const[0].get_partial_shape() == PartialShape([2])
 
 
+@pytest.mark.precommit
+def test_pytorch_decoder_shares_bf16_tensor_memory():
+    from openvino.frontend.pytorch.ts_decoder import TorchScriptPythonDecoder
+    from openvino import Type
+
+    class SomeTensor(torch.nn.Module):
+        def forward(self):
+            return torch.tensor([1, 2, 3, 4], dtype=torch.bfloat16)
+
+    model = get_scripted_model(SomeTensor())
+    consts = [n for n in model.inlined_graph.nodes() if n.kind() ==
+              "prim::Constant"]
+    assert len(consts) > 0
+    nc_decoder = TorchScriptPythonDecoder(model, consts[0])
+    ov_const = nc_decoder.as_constant()
+    assert ov_const[0].get_element_type() == Type.bf16
+    # bf16 data is shared as is, the constant owns the torch storage
+    assert nc_decoder.constant_statistics.shared_bytes == 4 * 2
+    assert nc_decoder.constant_statistics.copied_bytes == 0
+
+
+@pytest.mark.precommit
+def test_pytorch_decoder_reports_copied_weights():
+    from openvino.frontend.pytorch.ts_decoder import TorchScriptPythonDecoder
+
+    class SomeTensor(torch.nn.Module):
+        def forward(self):
+            return torch.ones([2, 4], dtype=torch.float32)
+
+    model = get_scripted_model(SomeTensor())
+    consts = [n for n in model.inlined_graph.nodes() if n.kind() ==
+              "prim::Constant" and isinstance(n.output().type(), torch.TensorType)]
+    assert len(consts) > 0
+    shared_decoder = TorchScriptPythonDecoder(model, consts[0])
+    shared_decoder.as_constant()
+    assert shared_decoder.constant_statistics.shared_bytes == 2 * 4 * 4
+    assert shared_decoder.constant_statistics.copied_bytes == 0
+
+    copied_decoder = TorchScriptPythonDecoder(model, consts[0], shared_memory=False)
+    copied_decoder.as_constant()
+    assert copied_decoder.constant_statistics.shared_bytes == 0
+    assert copied_decoder.constant_statistics.copied_bytes == 2 * 4 * 4
+
+
 @pytest.mark.precommit
 def test_pytorch_decoder_can_convert_fp32_tensor():
     from openvino.frontend.pytorch.ts_decoder import TorchScriptPythonDecoder
@@ -525,6 +525,8 @@ def _convert(cli_parser: argparse.ArgumentParser, args, python_api_used):
             pytorch_model_on_disk = True
 
         ov_model = driver(argv, {"conversion_parameters": non_default_params})
+        # the PyTorch decoder counts the weight memory shared with or copied to the Constants during the conversion
+        constant_statistics = getattr(argv.input_model, "constant_statistics", None)
 
         if pytorch_model_on_disk:
             # release memory allocated for temporal object
@@ -540,10 +542,18 @@ def _convert(cli_parser: argparse.ArgumentParser, args, python_api_used):
         ov_model.set_rt_info(get_rt_version(), "Runtime_version")
         for key, value in non_default_params.items():
             ov_model.set_rt_info(str(value), ["conversion_parameters", str(key)])
+        if constant_statistics is not None:
+            ov_model.set_rt_info(str(constant_statistics.shared_bytes),
+                                 ["conversion_statistics", "shared_constant_bytes"])
+            ov_model.set_rt_info(str(constant_statistics.copied_bytes),
+                                 ["conversion_statistics", "copied_constant_bytes"])
 
         if is_verbose(argv) or not python_api_used:
             if 'compress_to_fp16' in argv and argv.compress_to_fp16:
                 print(get_compression_message())
+        if is_verbose(argv) and constant_statistics is not None:
+            print("[ INFO ] Framework weights shared with the model: {:.2f} MB, copied: {:.2f} MB. ".format(
+                constant_statistics.shared_bytes / (1024 * 1024), constant_statistics.copied_bytes / (1024 * 1024)))
 
         send_conversion_result('success')
 